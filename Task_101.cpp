@@ -1,9 +1,20 @@
 #include <SDL2/SDL.h>
 #include <stdio.h>
 #include <math.h>
+#include <string.h>
+#include "circle.h"
+#include "circle_aa.h"
+#include "circle_cache.h"
+#include "circle_mesh.h"
+#include "frame_stats.h"
+#include "frame_pacer.h"
+#include "frame_bench.h"
+#include "render_backend.h"
 
 #define SCREEN_WIDTH 640
 #define SCREEN_HEIGHT 480
+#define IDLE_TIMEOUT_MS 500
+#define CIRCLE_RADIUS 100
 
 bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer)
  {
@@ -23,7 +34,7 @@ bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer)
         return false;
     }
 
-    *renderer = SDL_CreateRenderer(*window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    *renderer = createRenderer(*window, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
 
     if (*renderer == NULL) 
     {
@@ -35,18 +46,17 @@ bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer)
     return true;
 }
 
-void drawSolidCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius) 
+bool hasArgument(int argc, char* argv[], const char* name)
 {
-    for (int x = -radius; x <= radius; x++) 
+    for (int i = 1; i < argc; i++)
     {
-        for (int y = -radius; y <= radius; y++) 
+        if (strcmp(argv[i], name) == 0)
         {
-            if (x*x + y*y <= radius*radius) 
-            {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
+            return true;
         }
     }
+
+    return false;
 }
 
 int main(int argc, char* argv[]) 
@@ -60,34 +70,156 @@ int main(int argc, char* argv[])
         return 1;
     }
 
+    // --per-pixel, --spans, --cached or --mesh select the circle routine for comparison
+
+    const char* drawerName;
+
+    CircleDrawer drawCircle = chooseCircleDrawer(argc, argv, drawCachedCircle, &drawerName);
+
+    // the spans of a CIRCLE_RADIUS circle come from a table built at compile time
+
+    if (drawCircle == drawSolidCircle)
+    {
+        drawCircle = drawFixedCircle<CIRCLE_RADIUS>;
+    }
+
+    // --aa draws an anti-aliased circle on the CPU instead (circle_aa.h), once,
+    // and after that only copies it; it is uploaded again if the renderer loses it
+
+    bool antialiased = hasArgument(argc, argv, "--aa");
+
+    AaCanvas aaCanvas;
+
+    if (antialiased)
+    {
+        antialiased = createAaCanvas(&aaCanvas, renderer, SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+
+    if (antialiased)
+    {
+        // the canvas starts transparent, so the circle is written rather than
+        // blended; without a blended canvas transparent shows as the black clear
+
+        clearAaCanvas(&aaCanvas, {0, 0, 0, 0});
+
+        drawAaCircle(&aaCanvas.target, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2, CIRCLE_RADIUS, {255, 255, 255, 255}, AA_REPLACE);
+
+        drawerName = "aa";
+    }
+
+    FrameStats frameStats;
+
+    initFrameStats(&frameStats, drawerName);
+
+    // frames are paced to --fps (default 60) unless the renderer already waits for vsync
+
+    FramePacer pacer;
+
+    initFramePacer(&pacer, renderer, targetFpsFromArguments(argc, argv));
+
+    // the circle never moves, so once it is drawn the loop sleeps until an event
+    // arrives; --continuous redraws every frame anyway (for the per frame numbers),
+    // and so does --bench N, which measures N frames and stops (frame_bench.h)
+
+    FrameBench bench;
+
+    initFrameBench(&bench, argc, argv);
+
+    bool continuous = hasArgument(argc, argv, "--continuous") || benchmarking(&bench);
+
+    bool redraw = true;
+
     SDL_Event event;
 
     bool running = true;
 
     while (running) 
     {
+        if (!redraw)
+        {
+            waitWhileIdle(&pacer, IDLE_TIMEOUT_MS);
+        }
+
         while (SDL_PollEvent(&event)) 
         {
             if (event.type == SDL_QUIT) 
             {
                 running = false;
             }
+            else if (event.type == SDL_WINDOWEVENT)
+            {
+                redraw = true;
+            }
+            else if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET)
+            {
+                if (antialiased)
+                {
+                    aaCanvas.target.dirty = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+                }
+
+                redraw = true;
+            }
         }
 
-        
+        if (!redraw || !running)
+        {
+            continue;
+        }
+
+        beginFrame(&frameStats);
+
+        circleRenderCalls = 0;
+
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
 
-        SDL_RenderClear(renderer);
+        renderClear(renderer);
 
         
-        SDL_SetRenderDrawColor(renderer, 255,255,255, 255);
+        if (antialiased)
+        {
+            presentAaCanvas(renderer, &aaCanvas, NULL);
+        }
+        else
+        {
+            SDL_SetRenderDrawColor(renderer, 255,255,255, 255);
 
-        drawSolidCircle(renderer, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2, 100);
+            drawCircle(renderer, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2, CIRCLE_RADIUS);
+
+            flushCircleMesh(renderer);
+        }
 
-        SDL_RenderPresent(renderer);
+        endFrame(&frameStats, circleRenderCalls);
+
+        waitForNextFrame(&pacer);
+
+        renderPresent(renderer);
+
+        if (!benchFrame(&bench, circleRenderCalls))
+        {
+            running = false;
+        }
+
+        redraw = continuous;
+    }
+
+    if (benchmarking(&bench))
+    {
+        writeFrameBench(&bench);
+    }
+
+    if (drawCircle == drawCachedCircle)
+    {
+        printCircleCacheStats();
+    }
+
+    clearCircleCache();
+
+    if (antialiased)
+    {
+        destroyAaCanvas(&aaCanvas);
     }
 
-    SDL_DestroyRenderer(renderer);
+    destroyRenderer(renderer);
 
     SDL_DestroyWindow(window);
     
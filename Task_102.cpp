@@ -1,6 +1,15 @@
 #include <SDL2/SDL.h>
 #include <stdio.h>
 #include <math.h>
+#include <string.h>
+#include "circle.h"
+#include "circle_aa.h"
+#include "circle_cache.h"
+#include "circle_mesh.h"
+#include "frame_stats.h"
+#include "frame_pacer.h"
+#include "frame_bench.h"
+#include "render_backend.h"
 
 #define SCREEN_WIDTH 640
 #define SCREEN_HEIGHT 480
@@ -25,7 +34,7 @@ bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer)
         return false;
     }
 
-    *renderer = SDL_CreateRenderer(*window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    *renderer = createRenderer(*window, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
 
     if (*renderer == NULL) 
     {
@@ -37,18 +46,17 @@ bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer)
     return true;
 }
 
-void drawSolidCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius) 
+bool hasArgument(int argc, char* argv[], const char* name)
 {
-    for (int x = -radius; x <= radius; x++) 
+    for (int i = 1; i < argc; i++)
     {
-        for (int y = -radius; y <= radius; y++) 
+        if (strcmp(argv[i], name) == 0)
         {
-            if (x*x + y*y <= radius*radius) 
-            {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
+            return true;
         }
     }
+
+    return false;
 }
 
 int main(int argc, char* argv[]) 
@@ -62,6 +70,74 @@ int main(int argc, char* argv[])
         return 1;
     }
 
+    // --per-pixel, --spans, --cached or --mesh select the circle routine for comparison,
+    // the radius changes every frame so the cache mostly exercises its eviction
+
+    const char* drawerName;
+
+    CircleDrawer drawCircle = chooseCircleDrawer(argc, argv, drawSolidCircle, &drawerName);
+
+    // by default the disc is kept in a render target and only the newly grown ring
+    // is filled each frame, --full (or any of the options above) redraws it whole
+
+    bool incremental = !hasArgument(argc, argv, "--full") && !hasArgument(argc, argv, "--per-pixel")
+                    && !hasArgument(argc, argv, "--spans") && !hasArgument(argc, argv, "--cached")
+                    && !hasArgument(argc, argv, "--mesh") && !hasArgument(argc, argv, "--aa");
+
+    // --aa grows an anti-aliased disc on the CPU the same way (circle_aa.h): each
+    // frame writes the new ring over the transparent canvas and uploads just its
+    // box; a replaced ring grows the disc inside it, so nothing has to be blended
+
+    bool antialiased = hasArgument(argc, argv, "--aa");
+
+    AaCanvas aaCanvas;
+
+    if (antialiased)
+    {
+        antialiased = createAaCanvas(&aaCanvas, renderer, SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+
+    if (antialiased)
+    {
+        drawerName = "aa";
+    }
+
+    SDL_Texture* canvas = NULL;
+
+    if (incremental)
+    {
+        canvas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+        if (canvas == NULL)
+        {
+            printf("Canvas creation failed, redrawing every frame: %s\n", SDL_GetError());
+
+            incremental = false;
+        }
+        else
+        {
+            drawerName = "incremental";
+        }
+    }
+
+    int drawnRadius = -1; // radius already on the canvas, -1 when it has to be cleared
+
+    FrameStats frameStats;
+
+    initFrameStats(&frameStats, drawerName);
+
+    // frames are paced to --fps (default 60) unless the renderer already waits for vsync
+
+    FramePacer pacer;
+
+    initFramePacer(&pacer, renderer, targetFpsFromArguments(argc, argv));
+
+    // --bench N measures N frames and stops, see frame_bench.h
+
+    FrameBench bench;
+
+    initFrameBench(&bench, argc, argv);
+
     SDL_Event event;
 
     bool running = true;
@@ -80,6 +156,15 @@ int main(int argc, char* argv[])
             {
                 running = false;
             }
+            else if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET)
+            {
+                drawnRadius = -1;
+
+                if (antialiased)
+                {
+                    aaCanvas.target.dirty = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+                }
+            }
         }
 
         radius += RADIUS_INCREMENT;
@@ -89,18 +174,111 @@ int main(int argc, char* argv[])
             radius = INITIAL_RADIUS;
         }
 
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        beginFrame(&frameStats);
+
+        circleRenderCalls = 0;
+
+        if (antialiased)
+        {
+            if (radius < drawnRadius)
+            {
+                drawnRadius = -1;
+            }
+
+            if (drawnRadius < 0)
+            {
+                clearAaCanvas(&aaCanvas, {0, 0, 0, 0});
+            }
+
+            drawAaRing(&aaCanvas.target, centerX, centerY, drawnRadius, radius, {255, 255, 255, 255}, AA_REPLACE);
+
+            drawnRadius = radius;
+
+            // a blended canvas shows the black clear through its transparent
+            // pixels, otherwise transparent is copied as black
+            if (aaCanvas.blended)
+            {
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+
+                renderClear(renderer);
+            }
+
+            presentAaCanvas(renderer, &aaCanvas, NULL);
+        }
+        else if (incremental)
+        {
+            SDL_SetRenderTarget(renderer, canvas);
+
+            if (radius < drawnRadius)
+            {
+                drawnRadius = -1;
+            }
+
+            if (drawnRadius < 0)
+            {
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+
+                renderClear(renderer);
+            }
 
-        SDL_RenderClear(renderer);
+            SDL_SetRenderDrawColor(renderer, 255,255,255, 255);
 
-        SDL_SetRenderDrawColor(renderer, 255,255,255, 255);
+            drawSolidRing(renderer, centerX, centerY, drawnRadius, radius);
+
+            drawnRadius = radius;
+
+            SDL_SetRenderTarget(renderer, NULL);
+
+            SDL_RenderCopy(renderer, canvas, NULL, NULL);
+        }
+        else
+        {
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
 
-        drawSolidCircle(renderer, centerX, centerY, radius);
+            renderClear(renderer);
 
-        SDL_RenderPresent(renderer);
+            SDL_SetRenderDrawColor(renderer, 255,255,255, 255);
+
+            drawCircle(renderer, centerX, centerY, radius);
+
+            flushCircleMesh(renderer);
+        }
+
+        endFrame(&frameStats, circleRenderCalls);
+
+        waitForNextFrame(&pacer);
+
+        renderPresent(renderer);
+
+        if (!benchFrame(&bench, circleRenderCalls))
+        {
+            running = false;
+        }
+    }
+
+    if (benchmarking(&bench))
+    {
+        writeFrameBench(&bench);
+    }
+
+    if (drawCircle == drawCachedCircle)
+    {
+        printCircleCacheStats();
+    }
+
+    clearCircleCache();
+
+    if (canvas != NULL)
+    {
+        SDL_DestroyTexture(canvas);
+    }
+
+    if (antialiased)
+    {
+        destroyAaCanvas(&aaCanvas);
     }
 
-    SDL_DestroyRenderer(renderer);
+    destroyRenderer(renderer);
 
     SDL_DestroyWindow(window);
     
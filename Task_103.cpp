@@ -1,12 +1,30 @@
 #include <SDL2/SDL.h>
 #include <stdio.h>
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "circle.h"
+#include "circle_cache.h"
+#include "circle_mesh.h"
+#include "circle_world.h"
+#include "collision_grid.h"
+#include "dirty_region.h"
+#include "frame_stats.h"
+#include "frame_pacer.h"
+#include "frame_bench.h"
+#include "render_backend.h"
 
 #define SCREEN_WIDTH 640
 #define SCREEN_HEIGHT 480
 #define CIRCLE_RADIUS 30
 #define CIRCLE_SPEED 5
 #define BLINK_DURATION 10
+#define STRESS_RADIUS 2.0f
+#define STRESS_SPEED 1.5f
+#define STRESS_AREA_PER_CIRCLE 100.0f // world area per circle, keeps the density fixed as N grows
+#define STRESS_REPORT_INTERVAL 60
+#define STRESS_MAX_CIRCLES 10000000
 
 bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer) 
 {
@@ -26,7 +44,7 @@ bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer)
         return false;
     }
 
-    *renderer = SDL_CreateRenderer(*window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    *renderer = createRenderer(*window, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
 
     if (*renderer == NULL) 
     {
@@ -38,18 +56,225 @@ bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer)
     return true;
 }
 
-void drawCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius) 
+bool hasArgument(int argc, char* argv[], const char* name)
 {
-    for (int x = -radius; x <= radius; x++) 
+    for (int i = 1; i < argc; i++)
     {
-        for (int y = -radius; y <= radius; y++) 
+        if (strcmp(argv[i], name) == 0)
         {
-            if (x*x + y*y <= radius*radius) 
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// the N of --stress N, 0 unless it is a whole number from 1 to STRESS_MAX_CIRCLES
+int stressCount(const char* text)
+{
+    char* end;
+
+    long count = strtol(text, &end, 10);
+
+    if (end == text || *end != '\0' || count < 1 || count > STRESS_MAX_CIRCLES)
+    {
+        return 0;
+    }
+
+    return (int)count;
+}
+
+// the square a circle of CIRCLE_RADIUS drawn at (x, y) covers
+SDL_Rect circleBounds(float x, float y)
+{
+    return {(int)x - CIRCLE_RADIUS, (int)y - CIRCLE_RADIUS, 2 * CIRCLE_RADIUS + 1, 2 * CIRCLE_RADIUS + 1};
+}
+
+double elapsedMs(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
+
+// --stress N: N small circles bouncing around a world sized to keep the density
+// constant, collisions found through the uniform grid (or all pairs with --brute);
+// --mesh draws them as circles of at least a pixel in one SDL_RenderGeometry call
+int runStressMode(SDL_Renderer* renderer, int count, bool bruteForce, bool scalar, bool mesh, int targetFps, FrameBench* bench)
+{
+    float worldWidth = sqrtf(count * STRESS_AREA_PER_CIRCLE * SCREEN_WIDTH / SCREEN_HEIGHT);
+
+    float worldHeight = worldWidth * SCREEN_HEIGHT / SCREEN_WIDTH;
+
+    // cells roughly one per circle, but never smaller than a diameter
+
+    float cellSize = fmaxf(2.0f * STRESS_RADIUS, sqrtf(STRESS_AREA_PER_CIRCLE));
+
+    CircleWorld world;
+
+    for (int i = 0; i < count; i++)
+    {
+        float x = (float)rand() / RAND_MAX * worldWidth;
+
+        float y = (float)rand() / RAND_MAX * worldHeight;
+
+        float vx = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * STRESS_SPEED;
+
+        float vy = ((float)rand() / RAND_MAX * 2.0f - 1.0f) * STRESS_SPEED;
+
+        addCircle(&world, x, y, STRESS_RADIUS, vx, vy);
+    }
+
+    const char* kernelName = "scalar";
+
+    OverlapKernel kernel = scalar ? findOverlapsScalar : chooseOverlapKernel(&kernelName);
+
+    CollisionGrid grid;
+
+    std::vector<CollisionPair> hits;
+
+    std::vector<char> hitFlags(count);
+
+    std::vector<SDL_Point> points[2];
+
+    double moveMs = 0.0, buildMs = 0.0, narrowMs = 0.0, drawMs = 0.0;
+
+    CollisionStats stats = {0, 0};
+
+    int frames = 0;
+
+    FramePacer pacer;
+
+    initFramePacer(&pacer, renderer, targetFps);
+
+    printf("stress: %d circles in a %.0fx%.0f world, %s, %s narrow phase\n", count, worldWidth, worldHeight,
+           bruteForce ? "all pairs" : "uniform grid", kernelName);
+
+    SDL_Event event;
+
+    bool running = true;
+
+    while (running)
+    {
+        while (SDL_PollEvent(&event))
+        {
+            if (event.type == SDL_QUIT)
+            {
+                running = false;
+            }
+        }
+
+        Uint64 start = SDL_GetPerformanceCounter();
+
+        moveCircles(&world, worldWidth, worldHeight);
+
+        moveMs += elapsedMs(start);
+
+        hits.clear();
+
+        if (bruteForce)
+        {
+            start = SDL_GetPerformanceCounter();
+
+            findCollisionsBruteForce(&world, kernel, &hits, &stats);
+
+            narrowMs += elapsedMs(start);
+        }
+        else
+        {
+            start = SDL_GetPerformanceCounter();
+
+            buildCollisionGrid(&grid, &world, worldWidth, worldHeight, cellSize);
+
+            buildMs += elapsedMs(start);
+
+            start = SDL_GetPerformanceCounter();
+
+            findCollisions(&grid, kernel, &hits, &stats);
+
+            narrowMs += elapsedMs(start);
+        }
+
+        // the whole world is squeezed onto the screen, one point per circle
+
+        start = SDL_GetPerformanceCounter();
+
+        memset(hitFlags.data(), 0, count);
+
+        for (size_t i = 0; i < hits.size(); i++)
+        {
+            hitFlags[hits[i].first] = 1;
+
+            hitFlags[hits[i].second] = 1;
+        }
+
+        float scale = SCREEN_WIDTH / worldWidth;
+
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+
+        renderClear(renderer);
+
+        if (mesh)
+        {
+            const SDL_Color colors[2] = {{255, 255, 255, 255}, {255, 0, 0, 255}};
+
+            float radius = fmaxf(1.0f, STRESS_RADIUS * scale);
+
+            for (int i = 0; i < count; i++)
             {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
+                addMeshCircle(world.x[i] * scale, world.y[i] * scale, radius, colors[(int)hitFlags[i]]);
             }
+
+            flushCircleMesh(renderer);
+        }
+        else
+        {
+            points[0].clear();
+
+            points[1].clear();
+
+            for (int i = 0; i < count; i++)
+            {
+                points[(int)hitFlags[i]].push_back({(int)(world.x[i] * scale), (int)(world.y[i] * scale)});
+            }
+
+            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+
+            SDL_RenderDrawPoints(renderer, points[0].data(), (int)points[0].size());
+
+            SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
+
+            SDL_RenderDrawPoints(renderer, points[1].data(), (int)points[1].size());
+        }
+
+        drawMs += elapsedMs(start);
+
+        waitForNextFrame(&pacer);
+
+        renderPresent(renderer);
+
+        // the two point lists (or the mesh) are the only draws that grow with the circles
+
+        if (!benchFrame(bench, mesh ? 1 : 2))
+        {
+            running = false;
+        }
+
+        frames++;
+
+        if (frames == STRESS_REPORT_INTERVAL)
+        {
+            printf("stress: move %.2f ms, grid %.2f ms, narrow %.2f ms, draw %.2f ms, %ld pairs tested, %ld pairs hit per frame\n",
+                   moveMs / frames, buildMs / frames, narrowMs / frames, drawMs / frames,
+                   stats.pairsTested / frames, stats.pairsHit / frames);
+
+            moveMs = buildMs = narrowMs = drawMs = 0.0;
+
+            stats.pairsTested = stats.pairsHit = 0;
+
+            frames = 0;
         }
     }
+
+    return 0;
 }
 
 int main(int argc, char* argv[]) 
@@ -63,17 +288,119 @@ int main(int argc, char* argv[])
         return 1;
     }
 
+    // --bench N measures N frames and stops, see frame_bench.h
+
+    FrameBench bench;
+
+    initFrameBench(&bench, argc, argv);
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--stress") == 0)
+        {
+            int count = i + 1 < argc ? stressCount(argv[i + 1]) : 0;
+
+            if (count == 0)
+            {
+                printf("usage: Task_103 --stress N [--brute] [--scalar] [--mesh], N from 1 to %d\n", STRESS_MAX_CIRCLES);
+
+                destroyRenderer(renderer);
+
+                SDL_DestroyWindow(window);
+
+                SDL_Quit();
+
+                return 1;
+            }
+
+            // the options may come before or after --stress N
+
+            bool bruteForce = hasArgument(argc, argv, "--brute");
+
+            bool scalar = hasArgument(argc, argv, "--scalar");
+
+            bool mesh = hasArgument(argc, argv, "--mesh");
+
+            int result = runStressMode(renderer, count, bruteForce, scalar, mesh, targetFpsFromArguments(argc, argv), &bench);
+
+            if (benchmarking(&bench))
+            {
+                writeFrameBench(&bench);
+            }
+
+            destroyRenderer(renderer);
+
+            SDL_DestroyWindow(window);
+
+            SDL_Quit();
+
+            return result;
+        }
+    }
+
+    // --per-pixel, --spans, --cached or --mesh select the circle routine for
+    // comparison; with --mesh both circles go out in one SDL_RenderGeometry call
+
+    const char* drawerName;
+
+    CircleDrawer drawCircle = chooseCircleDrawer(argc, argv, drawCachedCircle, &drawerName);
+
+    // the spans of a CIRCLE_RADIUS circle come from a table built at compile time
+
+    if (drawCircle == drawSolidCircle)
+    {
+        drawCircle = drawFixedCircle<CIRCLE_RADIUS>;
+    }
+
+    // only the squares around the circles are cleared and redrawn, on a canvas
+    // that keeps the rest of the frame, unless --full-redraw asks for the old way
+
+    bool dirtyRedraw = !hasArgument(argc, argv, "--full-redraw");
+
+    DirtyRegion dirty;
+
+    if (dirtyRedraw && !createDirtyRegion(&dirty, renderer, SCREEN_WIDTH, SCREEN_HEIGHT))
+    {
+        printf("Redrawing the whole screen every frame\n");
+
+        dirtyRedraw = false;
+    }
+
+    SDL_Color background = {0, 0, 0, 255};
+
+    SDL_Rect drawnBounds[2] = {{0, 0, 0, 0}, {0, 0, 0, 0}}; // where each circle is on the canvas
+
+    SDL_Color drawnColors[2] = {{0, 0, 0, 0}, {0, 0, 0, 0}};
+
+    long circleArea = (2 * CIRCLE_RADIUS + 1) * (2 * CIRCLE_RADIUS + 1);
+
+    FrameStats frameStats;
+
+    initFrameStats(&frameStats, drawerName);
+
+    // frames are paced to --fps (default 60) unless the renderer already waits for vsync
+
+    FramePacer pacer;
+
+    initFramePacer(&pacer, renderer, targetFpsFromArguments(argc, argv));
+
     SDL_Event event;
 
     bool running = true;
 
-    int circle1X = 0;
+    // circle 0 moves across the screen on its own, circle 1 follows the arrow keys
+
+    CircleWorld world;
+
+    int circle1 = addCircle(&world, 0, SCREEN_HEIGHT / 2, CIRCLE_RADIUS, CIRCLE_SPEED, 0);
 
-    int circle1Y = SCREEN_HEIGHT / 2;
+    int circle2 = addCircle(&world, SCREEN_WIDTH / 2, 0, CIRCLE_RADIUS, 0, 0);
 
-    int circle2X = SCREEN_WIDTH / 2;
+    const char* kernelName;
 
-    int circle2Y = 0;
+    OverlapKernel findOverlaps = chooseOverlapKernel(&kernelName);
+
+    int overlaps[1];
 
     bool collided = false;
 
@@ -87,21 +414,28 @@ int main(int argc, char* argv[])
             {
                 running = false;
             }
+            else if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET)
+            {
+                if (dirtyRedraw)
+                {
+                    markAllDirty(&dirty);
+                }
+            }
             else if (event.type == SDL_KEYDOWN) 
             {
                 switch (event.key.keysym.sym) 
                 {
                     case SDLK_UP:
-                        circle2Y -= CIRCLE_SPEED;
+                        world.y[circle2] -= CIRCLE_SPEED;
                         break;
                     case SDLK_DOWN:
-                        circle2Y += CIRCLE_SPEED;
+                        world.y[circle2] += CIRCLE_SPEED;
                         break;
                     case SDLK_LEFT:
-                        circle2X -= CIRCLE_SPEED;
+                        world.x[circle2] -= CIRCLE_SPEED;
                         break;
                     case SDLK_RIGHT:
-                        circle2X += CIRCLE_SPEED;
+                        world.x[circle2] += CIRCLE_SPEED;
                         break;
                     default:
                         break;
@@ -109,68 +443,138 @@ int main(int argc, char* argv[])
             }
         }
 
-        circle1X += CIRCLE_SPEED;
+        world.x[circle1] += world.vx[circle1];
 
-        if (circle1X > SCREEN_WIDTH + CIRCLE_RADIUS) 
+        if (world.x[circle1] > SCREEN_WIDTH + CIRCLE_RADIUS) 
         {
-            circle1X = -CIRCLE_RADIUS;
+            world.x[circle1] = -CIRCLE_RADIUS;
         }
 
-        int dx = circle1X - circle2X;
-
-        int dy = circle1Y - circle2Y;
-
-        int distanceSquared = dx * dx + dy * dy;
-
-        int combinedRadius = CIRCLE_RADIUS * 2;
-
-        bool collision = distanceSquared <= combinedRadius * combinedRadius;
+        bool collision = findOverlaps(world.x[circle1], world.y[circle1], world.r[circle1],
+                                      world.x.data(), world.y.data(), world.r.data(), circle2, circle2 + 1, overlaps) > 0;
 
         if (collision && !collided) 
         {
             collided = true;
 
-            circle1X -= CIRCLE_SPEED;
+            world.x[circle1] -= world.vx[circle1];
 
             blinkTimer = BLINK_DURATION;
         }
 
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-
-        SDL_RenderClear(renderer);
-
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-
-        drawCircle(renderer, circle1X, circle1Y, CIRCLE_RADIUS);
-
-        SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-
-        drawCircle(renderer, circle2X, circle2Y, CIRCLE_RADIUS);
+        SDL_Color circle2Color = {255, 0, 0, 255};
 
         if (collided) 
         {
             if (blinkTimer > 0) 
             {
-                SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
-
-                drawCircle(renderer, circle2X, circle2Y, CIRCLE_RADIUS);
+                circle2Color = {255, 255, 0, 255};
 
                 blinkTimer--;
             } 
             else 
             {
                 collided = false;
+            }
+        }
+
+        beginFrame(&frameStats);
+
+        circleRenderCalls = 0;
+
+        if (!dirtyRedraw) 
+        {
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+
+            renderClear(renderer);
+
+            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+
+            drawCircle(renderer, (int)world.x[circle1], (int)world.y[circle1], CIRCLE_RADIUS);
+
+            SDL_SetRenderDrawColor(renderer, circle2Color.r, circle2Color.g, circle2Color.b, 255);
+
+            drawCircle(renderer, (int)world.x[circle2], (int)world.y[circle2], CIRCLE_RADIUS);
+
+            flushCircleMesh(renderer);
+
+            countPixels(&frameStats, SCREEN_WIDTH * SCREEN_HEIGHT + 2 * circleArea);
+        }
+        else 
+        {
+            // a circle is dirty where it was and where it is now, the blinking
+            // one also when only its colour changed
+
+            SDL_Rect bounds[2] = {circleBounds(world.x[circle1], world.y[circle1]), circleBounds(world.x[circle2], world.y[circle2])};
+
+            SDL_Color colors[2] = {{255, 255, 255, 255}, circle2Color};
+
+            for (int i = 0; i < 2; i++) 
+            {
+                if (!SDL_RectEquals(&bounds[i], &drawnBounds[i]) || memcmp(&colors[i], &drawnColors[i], sizeof(SDL_Color)) != 0) 
+                {
+                    markDirty(&dirty, &drawnBounds[i], &bounds[i]);
+
+                    drawnBounds[i] = bounds[i];
+
+                    drawnColors[i] = colors[i];
+                }
+            }
+
+            int rectCount = beginDirtyRedraw(renderer, &dirty, &background);
+
+            for (int rect = 0; rect < rectCount; rect++) 
+            {
+                for (int i = 0; i < 2; i++) 
+                {
+                    if (dirtyRectOverlaps(renderer, &dirty, rect, &bounds[i])) 
+                    {
+                        SDL_SetRenderDrawColor(renderer, colors[i].r, colors[i].g, colors[i].b, 255);
+
+                        drawCircle(renderer, bounds[i].x + CIRCLE_RADIUS, bounds[i].y + CIRCLE_RADIUS, CIRCLE_RADIUS);
+                    }
+                }
 
-                SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
+                // still under this rect's clip
 
-                drawCircle(renderer, circle2X, circle2Y, CIRCLE_RADIUS);
+                flushCircleMesh(renderer);
             }
+
+            countPixels(&frameStats, dirty.pixelsTouched);
+
+            endDirtyRedraw(renderer, &dirty);
+        }
+
+        endFrame(&frameStats, circleRenderCalls);
+
+        waitForNextFrame(&pacer);
+
+        renderPresent(renderer);
+
+        if (!benchFrame(&bench, circleRenderCalls))
+        {
+            running = false;
         }
+    }
+
+    if (benchmarking(&bench))
+    {
+        writeFrameBench(&bench);
+    }
 
-        SDL_RenderPresent(renderer);
+    if (drawCircle == drawCachedCircle)
+    {
+        printCircleCacheStats();
+    }
+
+    clearCircleCache();
+
+    if (dirtyRedraw)
+    {
+        destroyDirtyRegion(&dirty);
     }
 
-    SDL_DestroyRenderer(renderer);
+    destroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
 
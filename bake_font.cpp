@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "bitmap_font.h"
+
+// build step for embedded_font.h: renders the printable ASCII glyphs of a
+// TrueType font one bit per pixel (like TTF_RenderText_Solid) and writes them
+// out as constexpr tables, so the games start without opening a font file
+//
+//   bake_font FONT.ttf SIZE > embedded_font.h
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: bake_font FONT.ttf SIZE > embedded_font.h\n");
+
+        return 1;
+    }
+
+    FT_Library library;
+
+    FT_Face face;
+
+    if (FT_Init_FreeType(&library) != 0 || FT_New_Face(library, argv[1], 0, &face) != 0)
+    {
+        fprintf(stderr, "Font loading failed: %s\n", argv[1]);
+
+        return 1;
+    }
+
+    int size = atoi(argv[2]);
+
+    FT_Set_Pixel_Sizes(face, 0, size);
+
+    // same line metrics as SDL_ttf: ascent above the baseline, descent below it
+
+    int ascent = (int)(face->size->metrics.ascender + 63) / 64;
+
+    int descent = (int)(face->size->metrics.descender - 63) / 64;
+
+    int height = ascent - descent;
+
+    std::vector<unsigned char> bits;
+
+    printf("#ifndef EMBEDDED_FONT_H\n#define EMBEDDED_FONT_H\n\n");
+
+    const char* name = strrchr(argv[1], '/') != NULL ? strrchr(argv[1], '/') + 1 : argv[1];
+
+    printf("// generated by bake_font from %s at %d px, do not edit\n\n", name, size);
+
+    printf("#include \"bitmap_font.h\"\n\n");
+
+    printf("constexpr BitmapGlyph embeddedGlyphs[] =\n{\n");
+
+    for (int code = GLYPH_FIRST; code <= GLYPH_LAST; code++)
+    {
+        if (FT_Load_Char(face, code, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO | FT_LOAD_MONOCHROME) != 0)
+        {
+            fprintf(stderr, "Glyph %d missing, left empty\n", code);
+
+            printf("    {0, 0, 0, 0, 0, %zu},\n", bits.size());
+
+            continue;
+        }
+
+        FT_GlyphSlot slot = face->glyph;
+
+        const FT_Bitmap* bitmap = &slot->bitmap;
+
+        int top = ascent - slot->bitmap_top; // first bitmap row below the top of the line
+
+        printf("    {%d, %d, %d, %d, %d, %zu}, // '%c'\n", (int)bitmap->width, (int)bitmap->rows,
+               slot->bitmap_left, top, (int)((slot->advance.x + 32) / 64), bits.size(), code);
+
+        // rows of (width + 7) / 8 bytes, most significant bit first
+
+        for (unsigned int row = 0; row < bitmap->rows; row++)
+        {
+            for (unsigned int byte = 0; byte < (bitmap->width + 7) / 8; byte++)
+            {
+                bits.push_back(bitmap->buffer[row * bitmap->pitch + byte]);
+            }
+        }
+    }
+
+    printf("};\n\nconstexpr unsigned char embeddedGlyphBits[] =\n{");
+
+    for (size_t i = 0; i < bits.size(); i++)
+    {
+        printf(i % 16 == 0 ? "\n    0x%02x," : " 0x%02x,", bits[i]);
+    }
+
+    printf("\n};\n\nconstexpr BitmapFont embeddedFont = {embeddedGlyphs, embeddedGlyphBits, %d};\n\n#endif\n", height);
+
+    FT_Done_Face(face);
+
+    FT_Done_FreeType(library);
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "circle.h"
+#include "circle_aa.h"
+#include "circle_cache.h"
+#include "circle_mesh.h"
+#include "render_backend.h"
+
+// times the ways a filled circle can be drawn, all into the same ARGB8888
+// surface through SDL's software renderer (no window or GPU needed): one
+// point per pixel, one span per scanline, a cached sprite, triangle fans
+// through SDL_RenderGeometry (one call per frame, circle_mesh.h), the spans
+// written straight into the surface with fillPixels, and anti-aliased circles
+// written there too (circle_aa.h), with their edges stored (aa, as onto a
+// transparent layer) or blended (aa-over). every variant covers the same
+// pixels except the mesh, whose edges are within half a pixel of the circle,
+// and the aa ones, which also cover the pixels along the edge partly; ns/pixel
+// is per pixel of the span circle for all of them
+
+#define BENCH_TARGET_SIZE 2048
+#define BENCH_MIN_MS 20.0 // frames are repeated until a cell has run this long
+#define BENCH_POINTS_LIMIT 4000000L // per-pixel cells with more points per frame are skipped, they take minutes
+
+static SDL_Surface* target = NULL;
+
+// the spans of drawSolidCircle written into the target surface, no SDL call
+void drawSimdCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius)
+{
+    static std::vector<int> halfWidths;
+
+    halfWidths.resize(radius + 1);
+
+    computeCircleSpans(radius, halfWidths.data());
+
+    Uint8 r, g, b, a;
+
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+
+    Uint32 color = ((Uint32)a << 24) | ((Uint32)r << 16) | ((Uint32)g << 8) | b;
+
+    Uint8* pixels = (Uint8*)target->pixels;
+
+    for (int y = 0; y <= radius; y++)
+    {
+        int left = centerX - halfWidths[y];
+
+        int width = 2 * halfWidths[y] + 1;
+
+        fillPixels((Uint32*)(pixels + (centerY - y) * target->pitch) + left, width, color);
+
+        if (y > 0)
+        {
+            fillPixels((Uint32*)(pixels + (centerY + y) * target->pitch) + left, width, color);
+        }
+    }
+}
+
+// the anti-aliased circle written into the target surface, no SDL call
+static void drawAaBenchCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius, AaBlend blend)
+{
+    SDL_Color color;
+
+    SDL_GetRenderDrawColor(renderer, &color.r, &color.g, &color.b, &color.a);
+
+    AaTarget aaTarget = {(Uint32*)target->pixels, target->pitch / (int)sizeof(Uint32), target->w, target->h, {0, 0, 0, 0}};
+
+    drawAaCircle(&aaTarget, centerX, centerY, radius, color, blend);
+}
+
+// as onto a transparent layer, the edges stored
+void drawAaReplaceCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius)
+{
+    drawAaBenchCircle(renderer, centerX, centerY, radius, AA_REPLACE);
+}
+
+// composited over what the surface holds, the edges blended
+void drawAaOverCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius)
+{
+    drawAaBenchCircle(renderer, centerX, centerY, radius, AA_OVER);
+}
+
+typedef struct CircleVariant
+{
+    const char* name;
+    CircleDrawer draw;
+} CircleVariant;
+
+typedef struct CellResult
+{
+    double nsPerPixel;
+    double callsPerCircle;
+    bool skipped;
+} CellResult;
+
+long circleArea(int radius)
+{
+    std::vector<int> halfWidths(radius + 1);
+
+    computeCircleSpans(radius, halfWidths.data());
+
+    long area = 2 * halfWidths[0] + 1;
+
+    for (int y = 1; y <= radius; y++)
+    {
+        area += 2 * (2 * halfWidths[y] + 1);
+    }
+
+    return area;
+}
+
+// draws the circles once untimed (the cache fills its sprites then), then
+// whole frames of them until BENCH_MIN_MS has passed
+CellResult measureCell(SDL_Renderer* renderer, const CircleVariant* variant, const std::vector<SDL_Point>& centers, int radius)
+{
+    CellResult result = {0.0, 0.0, false};
+
+    long pixels = circleArea(radius) * (long)centers.size();
+
+    if (variant->draw == drawSolidCirclePoints && pixels > BENCH_POINTS_LIMIT)
+    {
+        result.skipped = true;
+
+        return result;
+    }
+
+    for (const SDL_Point& center : centers)
+    {
+        variant->draw(renderer, center.x, center.y, radius);
+    }
+
+    flushCircleMesh(renderer);
+
+    SDL_RenderFlush(renderer);
+
+    circleRenderCalls = 0;
+
+    long frames = 0;
+
+    double elapsedMs = 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    while (elapsedMs < BENCH_MIN_MS)
+    {
+        for (const SDL_Point& center : centers)
+        {
+            variant->draw(renderer, center.x, center.y, radius);
+        }
+
+        flushCircleMesh(renderer);
+
+        // the software renderer queues its commands, this is where the pixels are written
+
+        SDL_RenderFlush(renderer);
+
+        frames++;
+
+        elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    result.nsPerPixel = elapsedMs * 1e6 / ((double)pixels * frames);
+
+    result.callsPerCircle = (double)circleRenderCalls / ((double)centers.size() * frames);
+
+    return result;
+}
+
+int main()
+{
+    target = SDL_CreateRGBSurfaceWithFormat(0, BENCH_TARGET_SIZE, BENCH_TARGET_SIZE, 32, SDL_PIXELFORMAT_ARGB8888);
+
+    SDL_Renderer* renderer = target != NULL ? SDL_CreateSoftwareRenderer(target) : NULL;
+
+    if (renderer == NULL)
+    {
+        printf("Software renderer creation failed: %s\n", SDL_GetError());
+
+        return 1;
+    }
+
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+
+    const CircleVariant variants[] =
+    {
+        {"points", drawSolidCirclePoints},
+        {"spans", drawSolidCircle},
+        {"cached", drawCachedCircle},
+        {"mesh", drawMeshCircle},
+        {"simd", drawSimdCircle},
+        {"aa", drawAaReplaceCircle},
+        {"aa-over", drawAaOverCircle}
+    };
+
+    // 30, 50 and 100 are the radii the Task programs draw
+
+    const int radii[] = {1, 2, 4, 8, 16, 30, 32, 50, 64, 100, 128, 256, 512, 1000};
+
+    const int counts[] = {1, 16, 256};
+
+    printf("software renderer %dx%d, fillPixels uses %s, aa edges use %s\n\n", BENCH_TARGET_SIZE, BENCH_TARGET_SIZE, fillPixelsKernel(), aaSpanKernel());
+
+    printf("%6s %6s", "", "");
+
+    for (const CircleVariant& variant : variants)
+    {
+        printf(" | %-21s", variant.name);
+    }
+
+    printf("\n%6s %6s", "radius", "count");
+
+    for (int i = 0; i < (int)(sizeof(variants) / sizeof(variants[0])); i++)
+    {
+        printf(" | %10s %10s", "ns/pixel", "calls");
+    }
+
+    printf("\n");
+
+    for (int radius : radii)
+    {
+        for (int count : counts)
+        {
+            // the same spread of centers for every variant, each circle fully on the target
+
+            srand(radius * 1000 + count);
+
+            std::vector<SDL_Point> centers(count);
+
+            for (SDL_Point& center : centers)
+            {
+                int range = BENCH_TARGET_SIZE - 2 * radius;
+
+                center.x = radius + rand() % range;
+
+                center.y = radius + rand() % range;
+            }
+
+            printf("%6d %6d", radius, count);
+
+            for (const CircleVariant& variant : variants)
+            {
+                CellResult result = measureCell(renderer, &variant, centers, radius);
+
+                if (result.skipped)
+                {
+                    printf(" | %10s %10s", "-", "-");
+                }
+                else
+                {
+                    printf(" | %10.3f %10.1f", result.nsPerPixel, result.callsPerCircle);
+                }
+
+                fflush(stdout);
+            }
+
+            printf("\n");
+        }
+    }
+
+    clearCircleCache();
+
+    SDL_DestroyRenderer(renderer);
+
+    SDL_FreeSurface(target);
+
+    return 0;
+}
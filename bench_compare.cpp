@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// compares the JSON a --bench run writes (frame_bench.h) with the checked in
+// baseline of the same scene and fails when a number got worse by more than
+// the tolerance; max_ms is a single frame and too noisy to fail on, it is
+// only printed. a scene without a baseline fails too, since nothing was
+// compared, unless --allow-no-baseline is given
+//
+// usage: bench_compare [--allow-no-baseline] TOLERANCE_PERCENT BASELINE_DIR RESULTS_DIR SCENE...
+
+#define BENCH_FILE_MAX 4096
+
+typedef struct BenchMetric
+{
+    const char* key;
+    bool checked;
+} BenchMetric;
+
+static const BenchMetric metrics[] =
+{
+    {"p50_ms", true},
+    {"p99_ms", true},
+    {"max_ms", false},
+    {"draw_calls", true},
+    {"cpu_ms", true}
+};
+
+// reads a whole (small) file into text, false when it is missing
+bool readBenchFile(const char* path, char* text, size_t size)
+{
+    FILE* file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    size_t length = fread(text, 1, size - 1, file);
+
+    text[length] = '\0';
+
+    fclose(file);
+
+    return true;
+}
+
+// the number after "key": in the flat object frame_bench.cpp writes
+bool findNumber(const char* text, const char* key, double* value)
+{
+    char quoted[64];
+
+    snprintf(quoted, sizeof(quoted), "\"%s\":", key);
+
+    const char* found = strstr(text, quoted);
+
+    if (found == NULL)
+    {
+        return false;
+    }
+
+    char* end;
+
+    *value = strtod(found + strlen(quoted), &end);
+
+    return end != found + strlen(quoted);
+}
+
+int main(int argc, char* argv[])
+{
+    bool allowNoBaseline = argc > 1 && strcmp(argv[1], "--allow-no-baseline") == 0;
+
+    if (allowNoBaseline)
+    {
+        argc--;
+
+        argv++;
+    }
+
+    if (argc < 5)
+    {
+        printf("usage: bench_compare [--allow-no-baseline] TOLERANCE_PERCENT BASELINE_DIR RESULTS_DIR SCENE...\n");
+
+        return 2;
+    }
+
+    double tolerance = atof(argv[1]) / 100.0;
+
+    int regressions = 0, missing = 0;
+
+    for (int i = 4; i < argc; i++)
+    {
+        char path[512], baseline[BENCH_FILE_MAX], result[BENCH_FILE_MAX];
+
+        snprintf(path, sizeof(path), "%s/%s.json", argv[3], argv[i]);
+
+        if (!readBenchFile(path, result, sizeof(result)))
+        {
+            printf("%s: no result in %s\n", argv[i], path);
+
+            missing++;
+
+            continue;
+        }
+
+        snprintf(path, sizeof(path), "%s/%s.json", argv[2], argv[i]);
+
+        if (!readBenchFile(path, baseline, sizeof(baseline)))
+        {
+            printf("%s: no baseline in %s, make bench-baseline records one\n", argv[i], path);
+
+            missing += allowNoBaseline ? 0 : 1;
+
+            continue;
+        }
+
+        for (const BenchMetric& metric : metrics)
+        {
+            double before, after;
+
+            if (!findNumber(baseline, metric.key, &before) || !findNumber(result, metric.key, &after))
+            {
+                printf("%s: %s missing\n", argv[i], metric.key);
+
+                missing++;
+
+                continue;
+            }
+
+            double change = before > 0.0 ? after / before - 1.0 : 0.0;
+
+            bool regressed = metric.checked && after > before * (1.0 + tolerance);
+
+            printf("%-16s %-10s %10.4f -> %10.4f  %+6.1f%%%s\n", argv[i], metric.key, before, after, change * 100.0,
+                   regressed ? "  REGRESSION" : "");
+
+            regressions += regressed ? 1 : 0;
+        }
+    }
+
+    if (regressions > 0)
+    {
+        printf("%d regression(s) beyond %.0f%%\n", regressions, tolerance * 100.0);
+
+        return 1;
+    }
+
+    return missing > 0 ? 1 : 0;
+}
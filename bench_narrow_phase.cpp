@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "circle_world.h"
+
+// times the narrow phase kernels: one circle against runs of candidates of
+// different lengths, the way the grid calls it (short runs) and brute force
+// does (long runs)
+
+#define BENCH_CIRCLES 65536
+#define BENCH_PAIRS 50000000L // pairs tested per measurement
+#define BENCH_WORLD_SIZE 2560.0f
+#define BENCH_RADIUS 2.0f
+
+double measureKernel(OverlapKernel kernel, const CircleWorld* world, int runLength, long* hitTotal)
+{
+    int count = circleCount(world);
+
+    std::vector<int> hits(runLength);
+
+    long rounds = BENCH_PAIRS / runLength;
+
+    long found = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (long round = 0; round < rounds; round++)
+    {
+        int probe = (int)(round % count);
+
+        int begin = (int)((round * 7919) % (count - runLength));
+
+        found += kernel(world->x[probe], world->y[probe], world->r[probe],
+                        world->x.data(), world->y.data(), world->r.data(), begin, begin + runLength, hits.data());
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    *hitTotal = found;
+
+    return seconds * 1e9 / (double)(rounds * runLength);
+}
+
+int main()
+{
+    srand(1);
+
+    CircleWorld world;
+
+    for (int i = 0; i < BENCH_CIRCLES; i++)
+    {
+        addCircle(&world, (float)rand() / RAND_MAX * BENCH_WORLD_SIZE, (float)rand() / RAND_MAX * BENCH_WORLD_SIZE, BENCH_RADIUS, 0, 0);
+    }
+
+    bool avx2 = hasOverlapKernelAVX2();
+
+    printf("%10s %14s %14s %10s\n", "run", "scalar ns/pair", "avx2 ns/pair", "speedup");
+
+    int runLengths[] = {3, 8, 13, 32, 100, 1000, 10000};
+
+    for (int runLength : runLengths)
+    {
+        long scalarHits, avx2Hits = 0;
+
+        double scalarNs = measureKernel(findOverlapsScalar, &world, runLength, &scalarHits);
+
+        if (!avx2)
+        {
+            printf("%10d %14.3f %14s %10s\n", runLength, scalarNs, "n/a", "n/a");
+
+            continue;
+        }
+
+        double avx2Ns = measureKernel(findOverlapsAVX2, &world, runLength, &avx2Hits);
+
+        if (avx2Hits != scalarHits)
+        {
+            printf("kernels disagree at run %d: %ld vs %ld hits\n", runLength, scalarHits, avx2Hits);
+
+            return 1;
+        }
+
+        printf("%10d %14.3f %14.3f %9.2fx\n", runLength, scalarNs, avx2Ns, scalarNs / avx2Ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include "circle.h"
+#include "circle_spans.h"
+
+// times how the spans of drawSolidCircle are found for the radii the Task
+// programs use: testing x*x + y*y for every pixel of the bounding square, the
+// midpoint walk every draw, the table computed once and kept (circleSpans),
+// and the table built at compile time (CircleSpans<R>). every variant then
+// turns the half widths into the SDL_Rect spans drawSolidCircle submits,
+// nothing is drawn
+
+#define BENCH_MIN_MS 50.0 // circles are repeated until a cell has run this long
+#define BENCH_CENTERS 64
+
+static std::vector<SDL_Rect> spans;
+
+static long checksum = 0; // keeps the compiler from dropping the spans
+
+static void buildSpans(const int* halfWidths, int radius, int centerX, int centerY)
+{
+    for (int y = 0; y <= radius; y++)
+    {
+        int width = 2 * halfWidths[y] + 1;
+
+        spans[radius - y] = {centerX - halfWidths[y], centerY - y, width, 1};
+
+        spans[radius + y] = {centerX - halfWidths[y], centerY + y, width, 1};
+    }
+
+    checksum += spans[radius].w + spans[0].x;
+}
+
+// every pixel of the (2r+1)x(2r+1) square is tested, as drawSolidCirclePoints
+// does, and a row's half width is half the pixels inside it
+static void perPixelSpans(int radius, int* halfWidths)
+{
+    for (int y = -radius; y <= radius; y++)
+    {
+        int inside = 0;
+
+        for (int x = -radius; x <= radius; x++)
+        {
+            if (x*x + y*y <= radius*radius)
+            {
+                inside++;
+            }
+        }
+
+        halfWidths[y < 0 ? -y : y] = (inside - 1) / 2;
+    }
+}
+
+// ns per circle of draw(radius, centerX, centerY) over BENCH_CENTERS centres
+template <typename Draw>
+static double measure(Draw draw)
+{
+    for (int i = 0; i < BENCH_CENTERS; i++)
+    {
+        draw(100 + i, 100 + 3 * i);
+    }
+
+    long circles = 0;
+
+    double elapsedMs = 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    while (elapsedMs < BENCH_MIN_MS)
+    {
+        for (int i = 0; i < BENCH_CENTERS; i++)
+        {
+            draw(100 + i, 100 + 3 * i);
+        }
+
+        circles += BENCH_CENTERS;
+
+        elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    return elapsedMs * 1e6 / circles;
+}
+
+template <int R>
+static void benchRadius()
+{
+    static std::vector<int> halfWidths(R + 1);
+
+    spans.resize(2 * R + 1);
+
+    double perPixel = measure([](int centerX, int centerY)
+    {
+        perPixelSpans(R, halfWidths.data());
+
+        buildSpans(halfWidths.data(), R, centerX, centerY);
+    });
+
+    double walk = measure([](int centerX, int centerY)
+    {
+        computeCircleSpans(R, halfWidths.data());
+
+        buildSpans(halfWidths.data(), R, centerX, centerY);
+    });
+
+    double cached = measure([](int centerX, int centerY)
+    {
+        buildSpans(circleSpans(R), R, centerX, centerY);
+    });
+
+    double fixed = measure([](int centerX, int centerY)
+    {
+        buildSpans(fixedCircleSpans<R>(), R, centerX, centerY);
+    });
+
+    printf("%6d | %10.1f | %10.1f | %10.1f | %10.1f | %9.2fx\n", R, perPixel, walk, cached, fixed, walk / fixed);
+}
+
+int main()
+{
+    printf("ns per circle, spans built but not drawn\n\n");
+
+    printf("%6s | %10s | %10s | %10s | %10s | %10s\n", "radius", "per-pixel", "walk", "cached", "fixed", "walk/fixed");
+
+    benchRadius<30>();
+
+    benchRadius<50>();
+
+    benchRadius<100>();
+
+    printf("\n(checksum %ld)\n", checksum);
+
+    return 0;
+}
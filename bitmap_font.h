@@ -0,0 +1,26 @@
+#ifndef BITMAP_FONT_H
+#define BITMAP_FONT_H
+
+// a font as one bit per pixel glyph bitmaps, the form fonts are compiled into
+// the program in (embedded_font.h, written by bake_font)
+
+#define GLYPH_FIRST 32 // space
+#define GLYPH_LAST 126 // '~'
+
+typedef struct BitmapGlyph
+{
+    int width, rows; // bitmap size, 0 for glyphs with nothing to draw
+    int left; // first column relative to the pen, can be negative
+    int top; // first row below the top of the line
+    int advance; // pen movement to the next glyph
+    int offset; // first byte of the bitmap in BitmapFont::bits, rows of (width + 7) / 8 bytes, high bit first
+} BitmapGlyph;
+
+typedef struct BitmapFont
+{
+    const BitmapGlyph* glyphs; // GLYPH_FIRST to GLYPH_LAST
+    const unsigned char* bits;
+    int lineHeight;
+} BitmapFont;
+
+#endif
@@ -0,0 +1,159 @@
+#include "board_texture.h"
+#include <stdio.h>
+
+bool createBoardTexture(BoardTexture* board, SDL_Renderer* renderer, int columns, int rows)
+{
+    board->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, columns, rows);
+
+    if (board->texture == NULL)
+    {
+        printf("Board texture creation failed: %s\n", SDL_GetError());
+
+        return false;
+    }
+
+    SDL_SetTextureScaleMode(board->texture, SDL_ScaleModeNearest); // sharp cells, no blur between them
+
+    board->columns = columns;
+
+    board->rows = rows;
+
+    board->texels.assign(columns * rows, BOARD_EMPTY_COLOR);
+
+    board->dirty = {0, 0, columns, rows};
+
+    board->tick = 0;
+
+    board->drawn = false;
+
+    return true;
+}
+
+void destroyBoardTexture(BoardTexture* board)
+{
+    SDL_DestroyTexture(board->texture);
+
+    board->texture = NULL;
+}
+
+static void setTexel(BoardTexture* board, SnakeCell cell, Uint32 color)
+{
+    if (cell == SNAKE_NO_CELL)
+    {
+        return;
+    }
+
+    int column = cellColumn(cell);
+
+    int row = cellRow(cell);
+
+    board->texels[row * board->columns + column] = color;
+
+    // grow the dirty rectangle to include the cell
+
+    if (board->dirty.w == 0)
+    {
+        board->dirty = {column, row, 1, 1};
+
+        return;
+    }
+
+    int right = SDL_max(board->dirty.x + board->dirty.w, column + 1);
+
+    int bottom = SDL_max(board->dirty.y + board->dirty.h, row + 1);
+
+    board->dirty.x = SDL_min(board->dirty.x, column);
+
+    board->dirty.y = SDL_min(board->dirty.y, row);
+
+    board->dirty.w = right - board->dirty.x;
+
+    board->dirty.h = bottom - board->dirty.y;
+}
+
+static void rememberState(BoardTexture* board, const SnakeEngine* engine)
+{
+    board->tick = engine->tick;
+
+    board->food = engine->food;
+
+    board->bonusFood = engine->bonusFood;
+
+    board->poisonFood = engine->poisonFood;
+
+    board->drawn = true;
+}
+
+static void setFood(BoardTexture* board, const SnakeEngine* engine)
+{
+    setTexel(board, engine->food, BOARD_FOOD_COLOR);
+
+    setTexel(board, engine->bonusFood, BOARD_BONUS_COLOR);
+
+    setTexel(board, engine->poisonFood, BOARD_POISON_COLOR);
+}
+
+void updateBoardTexture(BoardTexture* board, const SnakeEngine* engine)
+{
+    if (board->drawn && engine->tick == board->tick)
+    {
+        return;
+    }
+
+    if (!board->drawn || engine->tick != board->tick + 1)
+    {
+        for (Uint32& texel : board->texels)
+        {
+            texel = BOARD_EMPTY_COLOR;
+        }
+
+        board->dirty = {0, 0, board->columns, board->rows};
+
+        for (int i = 0; i < engine->body.length; i++)
+        {
+            SnakeCell cell = snakeSegment(&engine->body, i);
+
+            board->texels[cellRow(cell) * board->columns + cellColumn(cell)] = BOARD_SNAKE_COLOR;
+        }
+
+        setFood(board, engine);
+
+        rememberState(board, engine);
+
+        return;
+    }
+
+    // one tick: food that moved or was eaten and the cell the tail left are
+    // cleared first, then the new head and food are drawn over them
+
+    setTexel(board, board->food, BOARD_EMPTY_COLOR);
+
+    setTexel(board, board->bonusFood, BOARD_EMPTY_COLOR);
+
+    setTexel(board, board->poisonFood, BOARD_EMPTY_COLOR);
+
+    if (snakeTail(&engine->body) != engine->lastTail)
+    {
+        setTexel(board, engine->lastTail, BOARD_EMPTY_COLOR);
+    }
+
+    setTexel(board, snakeHead(&engine->body), BOARD_SNAKE_COLOR);
+
+    setFood(board, engine);
+
+    rememberState(board, engine);
+}
+
+void drawBoardTexture(SDL_Renderer* renderer, BoardTexture* board, const SDL_Rect* destination)
+{
+    if (board->dirty.w > 0)
+    {
+        const Uint32* first = &board->texels[board->dirty.y * board->columns + board->dirty.x];
+
+        SDL_UpdateTexture(board->texture, &board->dirty, first, board->columns * (int)sizeof(Uint32));
+
+        board->dirty.w = 0;
+    }
+
+    SDL_RenderCopy(renderer, board->texture, NULL, destination);
+}
@@ -0,0 +1,41 @@
+#ifndef BOARD_TEXTURE_H
+#define BOARD_TEXTURE_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include "snake_engine.h"
+
+// the whole snake board as a texture with one texel per cell, drawn with a
+// single scaled SDL_RenderCopy; after a tick only the cells that changed are
+// rewritten and uploaded, so a frame costs the same at any snake length
+// (the snake moves cell by cell, there is no interpolation in this mode)
+
+#define BOARD_EMPTY_COLOR 0xff000000u
+#define BOARD_SNAKE_COLOR 0xff00ff00u
+#define BOARD_FOOD_COLOR 0xffff0000u
+#define BOARD_BONUS_COLOR 0xff0000ffu
+#define BOARD_POISON_COLOR 0xff800080u
+
+typedef struct BoardTexture
+{
+    SDL_Texture* texture;
+    int columns, rows;
+    std::vector<Uint32> texels; // the texture's contents
+    SDL_Rect dirty; // texels changed since the last upload, w == 0 when none
+    uint32_t tick; // engine tick the texels show
+    SnakeCell food, bonusFood, poisonFood; // as drawn at that tick
+    bool drawn; // false until the first full redraw
+} BoardTexture;
+
+bool createBoardTexture(BoardTexture* board, SDL_Renderer* renderer, int columns, int rows);
+
+void destroyBoardTexture(BoardTexture* board);
+
+// brings the texels up to the engine's state: the changed cells after a single
+// tick, the whole board after a jump (reset, seek, several ticks in a frame)
+void updateBoardTexture(BoardTexture* board, const SnakeEngine* engine);
+
+// uploads what changed and stretches the board over destination
+void drawBoardTexture(SDL_Renderer* renderer, BoardTexture* board, const SDL_Rect* destination);
+
+#endif
@@ -0,0 +1,166 @@
+#include "circle.h"
+#include "circle_cache.h"
+#include "circle_mesh.h"
+#include "circle_spans.h"
+#include "render_backend.h"
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+int circleRenderCalls = 0;
+
+static std::unordered_map<int, std::vector<int>> spanTables;
+
+void computeCircleSpans(int radius, int* halfWidths)
+{
+    walkCircleSpans(radius, halfWidths);
+}
+
+const int* circleSpans(int radius)
+{
+    std::vector<int>& table = spanTables[radius];
+
+    if (table.empty())
+    {
+        table.resize(radius + 1);
+
+        computeCircleSpans(radius, table.data());
+    }
+
+    return table.data();
+}
+
+void drawCircleSpans(SDL_Renderer* renderer, int centerX, int centerY, int radius, const int* halfWidths)
+{
+    static std::vector<SDL_Rect> spans;
+
+    spans.resize(2 * radius + 1);
+
+    for (int y = 0; y <= radius; y++)
+    {
+        int width = 2 * halfWidths[y] + 1;
+
+        spans[radius - y] = {centerX - halfWidths[y], centerY - y, width, 1};
+
+        spans[radius + y] = {centerX - halfWidths[y], centerY + y, width, 1};
+    }
+
+    renderFillRects(renderer, spans.data(), (int)spans.size());
+
+    circleRenderCalls++;
+}
+
+void drawSolidCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius)
+{
+    if (radius < 0)
+    {
+        return;
+    }
+
+    drawCircleSpans(renderer, centerX, centerY, radius, circleSpans(radius));
+}
+
+void drawSolidRing(SDL_Renderer* renderer, int centerX, int centerY, int innerRadius, int outerRadius)
+{
+    if (outerRadius < 0 || innerRadius >= outerRadius)
+    {
+        return;
+    }
+
+    if (innerRadius < 0)
+    {
+        innerRadius = -1;
+    }
+
+    static std::vector<SDL_Rect> spans;
+
+    spans.clear();
+
+    const int* outerWidths = circleSpans(outerRadius);
+
+    const int* innerWidths = innerRadius >= 0 ? circleSpans(innerRadius) : NULL;
+
+    for (int y = -outerRadius; y <= outerRadius; y++)
+    {
+        int row = y < 0 ? -y : y;
+
+        int outer = outerWidths[row];
+
+        int inner = row <= innerRadius ? innerWidths[row] : -1;
+
+        if (inner < 0)
+        {
+            spans.push_back({centerX - outer, centerY + y, 2 * outer + 1, 1});
+        }
+        else if (outer > inner)
+        {
+            spans.push_back({centerX - outer, centerY + y, outer - inner, 1});
+
+            spans.push_back({centerX + inner + 1, centerY + y, outer - inner, 1});
+        }
+    }
+
+    renderFillRects(renderer, spans.data(), (int)spans.size());
+
+    circleRenderCalls++;
+}
+
+void drawSolidCirclePoints(SDL_Renderer* renderer, int centerX, int centerY, int radius)
+{
+    for (int x = -radius; x <= radius; x++)
+    {
+        for (int y = -radius; y <= radius; y++)
+        {
+            if (x*x + y*y <= radius*radius)
+            {
+                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
+
+                circleRenderCalls++;
+            }
+        }
+    }
+}
+
+CircleDrawer chooseCircleDrawer(int argc, char* argv[], CircleDrawer defaultDrawer, const char** name)
+{
+    CircleDrawer drawer = defaultDrawer;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--per-pixel") == 0)
+        {
+            drawer = drawSolidCirclePoints;
+        }
+        else if (strcmp(argv[i], "--spans") == 0)
+        {
+            drawer = drawSolidCircle;
+        }
+        else if (strcmp(argv[i], "--cached") == 0)
+        {
+            drawer = drawCachedCircle;
+        }
+        else if (strcmp(argv[i], "--mesh") == 0)
+        {
+            drawer = drawMeshCircle;
+        }
+    }
+
+    if (drawer == drawSolidCirclePoints)
+    {
+        *name = "per-pixel";
+    }
+    else if (drawer == drawCachedCircle)
+    {
+        *name = "cached";
+    }
+    else if (drawer == drawMeshCircle)
+    {
+        *name = "mesh";
+    }
+    else
+    {
+        *name = "spans";
+    }
+
+    return drawer;
+}
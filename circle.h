@@ -0,0 +1,52 @@
+#ifndef CIRCLE_H
+#define CIRCLE_H
+
+#include <SDL2/SDL.h>
+#include "circle_spans.h"
+
+// number of SDL render calls issued by the circle routines, reset by the caller
+extern int circleRenderCalls;
+
+// writes the half width of rows 0..radius into halfWidths (radius + 1 entries)
+void computeCircleSpans(int radius, int* halfWidths);
+
+// the same half widths, computed on first use of a radius and kept
+const int* circleSpans(int radius);
+
+// filled circle drawn as one span per scanline from a half width table,
+// submitted in a single SDL_RenderFillRects call
+void drawCircleSpans(SDL_Renderer* renderer, int centerX, int centerY, int radius, const int* halfWidths);
+
+// drawCircleSpans with the kept table of radius
+void drawSolidCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius);
+
+// drawSolidCircle for a program's fixed radius R, whose table is built at
+// compile time (circle_spans.h); a CircleDrawer, so any other radius passed in
+// goes to drawSolidCircle
+template <int R>
+void drawFixedCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius)
+{
+    if (radius == R)
+    {
+        drawCircleSpans(renderer, centerX, centerY, R, fixedCircleSpans<R>());
+    }
+    else
+    {
+        drawSolidCircle(renderer, centerX, centerY, radius);
+    }
+}
+
+// pixels inside outerRadius but outside innerRadius, at most two spans per scanline
+// in one SDL_RenderFillRects call; an innerRadius below zero fills the whole disc
+void drawSolidRing(SDL_Renderer* renderer, int centerX, int centerY, int innerRadius, int outerRadius);
+
+// old one point per pixel version, kept around for comparison
+void drawSolidCirclePoints(SDL_Renderer* renderer, int centerX, int centerY, int radius);
+
+typedef void (*CircleDrawer)(SDL_Renderer* renderer, int centerX, int centerY, int radius);
+
+// picks the circle routine from --per-pixel, --spans, --cached or --mesh, falling
+// back to defaultDrawer; mesh circles only appear at flushCircleMesh (circle_mesh.h)
+CircleDrawer chooseCircleDrawer(int argc, char* argv[], CircleDrawer defaultDrawer, const char** name);
+
+#endif
@@ -0,0 +1,837 @@
+#include "circle_aa.h"
+#include "circle.h"
+#include "render_backend.h"
+#include <stdio.h>
+#include <string.h>
+#include <unordered_map>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CIRCLE_AA_X86 1
+#include <immintrin.h>
+#endif
+
+#define AA_SAMPLES 16 // per axis, for the edge pixels of a coverage table
+#define AA_EDGE_PADDING 3 // texels on either side of every row's run of edge texels, so runs go in groups of 4
+
+// coverage of the pixels of one quadrant of a circle, row dy and column dx
+// counted from the centre pixel: per row the last column fully covered and the
+// last covered at all, and the coverages of the columns between them
+typedef struct CoverageRow
+{
+    int solid; // -1 when none
+    int extent; // -1 when none
+    int offset; // of the row's dx = solid + 1 .. extent in coverage
+} CoverageRow;
+
+// the edge pixels of a circle premultiplied in one colour, so compositing them
+// is one multiply (over), an add or a plain store (replace). row dy's run sits
+// at offset + (2 * dy + 1) * AA_EDGE_PADDING; forward runs by dx outwards with
+// the colour before it and transparent after, backward runs the other way with
+// transparent before and the colour after. a group of 4 written past a run's
+// end then changes nothing, and one written inwards from its end only
+// overwrites the interior with its own colour
+typedef struct EdgeTexels
+{
+    Uint32 color; // what they were made for
+    std::vector<Uint32> forward;
+    std::vector<Uint32> backward;
+} EdgeTexels;
+
+typedef struct CoverageTable
+{
+    int radius;
+    std::vector<CoverageRow> rows;
+    std::vector<Uint8> coverage; // 0 - 255
+    EdgeTexels texels; // for the colour last drawn with
+} CoverageTable;
+
+static std::unordered_map<int, CoverageTable> tables;
+
+static void buildCoverageTable(CoverageTable* table, int radius)
+{
+    float reach = radius + 0.5f;
+
+    float reachSquared = reach * reach;
+
+    table->radius = radius;
+
+    for (int dy = 0; dy <= radius; dy++)
+    {
+        int solid = -1, extent = -1;
+
+        for (int dx = 0; dx <= radius; dx++)
+        {
+            // the pixel's far corner in means all of it is, its nearest point out means none
+
+            float farX = dx + 0.5f, farY = dy + 0.5f;
+
+            float nearX = dx > 0 ? dx - 0.5f : 0.0f, nearY = dy > 0 ? dy - 0.5f : 0.0f;
+
+            if (farX * farX + farY * farY <= reachSquared)
+            {
+                solid = dx;
+            }
+
+            if (nearX * nearX + nearY * nearY < reachSquared)
+            {
+                extent = dx;
+            }
+        }
+
+        table->rows.push_back({solid, extent, (int)table->coverage.size()});
+
+        for (int dx = solid + 1; dx <= extent; dx++)
+        {
+            int inside = 0;
+
+            for (int i = 0; i < AA_SAMPLES; i++)
+            {
+                float sampleY = dy - 0.5f + (i + 0.5f) / AA_SAMPLES;
+
+                for (int j = 0; j < AA_SAMPLES; j++)
+                {
+                    float sampleX = dx - 0.5f + (j + 0.5f) / AA_SAMPLES;
+
+                    inside += sampleX * sampleX + sampleY * sampleY <= reachSquared ? 1 : 0;
+                }
+            }
+
+            table->coverage.push_back((Uint8)((inside * 255 + AA_SAMPLES * AA_SAMPLES / 2) / (AA_SAMPLES * AA_SAMPLES)));
+        }
+    }
+}
+
+// built on first use and kept, a radius costs about 10 bytes per edge pixel
+static CoverageTable* coverageTable(int radius)
+{
+    static CoverageTable* last = NULL; // circles mostly come in runs of one radius
+
+    if (last != NULL && last->radius == radius)
+    {
+        return last;
+    }
+
+    auto found = tables.find(radius);
+
+    if (found != tables.end())
+    {
+        last = &found->second;
+
+        return last;
+    }
+
+    CoverageTable* table = &tables[radius];
+
+    buildCoverageTable(table, radius);
+
+    last = table;
+
+    return table;
+}
+
+static int coverageAt(const CoverageTable* table, int dy, int dx)
+{
+    if (table == NULL || dy > table->radius)
+    {
+        return 0;
+    }
+
+    const CoverageRow* row = &table->rows[dy];
+
+    if (dx > row->extent)
+    {
+        return 0;
+    }
+
+    if (dx <= row->solid)
+    {
+        return 255;
+    }
+
+    return table->coverage[row->offset + dx - row->solid - 1];
+}
+
+static Uint32 premultiply(SDL_Color color)
+{
+    Uint32 r = (color.r * color.a + 127) / 255;
+
+    Uint32 g = (color.g * color.a + 127) / 255;
+
+    Uint32 b = (color.b * color.a + 127) / 255;
+
+    return ((Uint32)color.a << 24) | (r << 16) | (g << 8) | b;
+}
+
+// every channel times scale / 255, rounded
+static Uint32 scalePixel(Uint32 pixel, Uint32 scale)
+{
+    Uint32 redBlue = (pixel & 0x00ff00ffu) * scale + 0x00800080u;
+
+    Uint32 alphaGreen = ((pixel >> 8) & 0x00ff00ffu) * scale + 0x00800080u;
+
+    redBlue = ((redBlue + ((redBlue >> 8) & 0x00ff00ffu)) >> 8) & 0x00ff00ffu;
+
+    alphaGreen = (alphaGreen + ((alphaGreen >> 8) & 0x00ff00ffu)) & 0xff00ff00u;
+
+    return redBlue | alphaGreen;
+}
+
+static Uint32 overPixel(Uint32 dst, Uint32 src)
+{
+    return src + scalePixel(dst, 255 - (src >> 24));
+}
+
+// every channel added, saturating at 255
+static Uint32 addPixel(Uint32 dst, Uint32 src)
+{
+    Uint32 redBlue = (dst & 0x00ff00ffu) + (src & 0x00ff00ffu);
+
+    Uint32 alphaGreen = ((dst >> 8) & 0x00ff00ffu) + ((src >> 8) & 0x00ff00ffu);
+
+    redBlue |= ((redBlue >> 8) & 0x00010001u) * 0xff;
+
+    alphaGreen |= ((alphaGreen >> 8) & 0x00010001u) * 0xff;
+
+    return (redBlue & 0x00ff00ffu) | ((alphaGreen & 0x00ff00ffu) << 8);
+}
+
+static void overSpanScalar(Uint32* dst, int count, Uint32 color)
+{
+    for (int i = 0; i < count; i++)
+    {
+        dst[i] = overPixel(dst[i], color);
+    }
+}
+
+static void addSpanScalar(Uint32* dst, int count, Uint32 color)
+{
+    for (int i = 0; i < count; i++)
+    {
+        dst[i] = addPixel(dst[i], color);
+    }
+}
+
+// a run of edge pixels, each with its own premultiplied texel
+
+static void overTexelsScalar(Uint32* dst, const Uint32* texels, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        dst[i] = overPixel(dst[i], texels[i]);
+    }
+}
+
+static void addTexelsScalar(Uint32* dst, const Uint32* texels, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        dst[i] = addPixel(dst[i], texels[i]);
+    }
+}
+
+// one row of a replaced disc or ring fully on the target: the edge runs from
+// the texels of forward and backward (at each run's start) and the colour over
+// |dx| = from .. solid, from 0 for a disc
+static void storeRowScalar(Uint32* row, int centerX, int from, const CoverageRow* coverage, const Uint32* forward, const Uint32* backward,
+                           Uint32 color)
+{
+    int count = coverage->extent - coverage->solid;
+
+    // the centre column is in the right run only
+
+    int leftCount = coverage->solid < 0 ? count - 1 : count;
+
+    memcpy(row + centerX + coverage->solid + 1, forward, count * sizeof(Uint32));
+
+    memcpy(row + centerX - coverage->extent, backward, leftCount * sizeof(Uint32));
+
+    if (from == 0 && coverage->solid >= 0)
+    {
+        fillPixels(row + centerX - coverage->solid, 2 * coverage->solid + 1, color);
+    }
+    else if (from <= coverage->solid)
+    {
+        fillPixels(row + centerX - coverage->solid, coverage->solid - from + 1, color);
+
+        fillPixels(row + centerX + from, coverage->solid - from + 1, color);
+    }
+}
+
+#ifdef CIRCLE_AA_X86
+
+// x * scale / 255 in 16 bit lanes, rounded like scalePixel
+__attribute__((target("sse2"))) static __m128i scaleLanes(__m128i x, __m128i scale)
+{
+    x = _mm_add_epi16(_mm_mullo_epi16(x, scale), _mm_set1_epi16(128));
+
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// 4 pixels of dst scaled by 255 - the alpha of each source pixel, plus source
+__attribute__((target("sse2"))) static __m128i overLanes(__m128i pixels, __m128i source)
+{
+    __m128i zero = _mm_setzero_si128();
+
+    __m128i full = _mm_set1_epi16(255);
+
+    // every source pixel's alpha spread over its four lanes
+
+    __m128i low = _mm_unpacklo_epi8(source, zero);
+
+    __m128i high = _mm_unpackhi_epi8(source, zero);
+
+    low = _mm_sub_epi16(full, _mm_shufflehi_epi16(_mm_shufflelo_epi16(low, 0xff), 0xff));
+
+    high = _mm_sub_epi16(full, _mm_shufflehi_epi16(_mm_shufflelo_epi16(high, 0xff), 0xff));
+
+    low = scaleLanes(_mm_unpacklo_epi8(pixels, zero), low);
+
+    high = scaleLanes(_mm_unpackhi_epi8(pixels, zero), high);
+
+    return _mm_adds_epu8(_mm_packus_epi16(low, high), source);
+}
+
+__attribute__((target("sse2"))) static void overSpanSSE2(Uint32* dst, int count, Uint32 color)
+{
+    __m128i source = _mm_set1_epi32((int)color);
+
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_si128((__m128i*)(dst + i), overLanes(_mm_loadu_si128((__m128i*)(dst + i)), source));
+    }
+
+    overSpanScalar(dst + i, count - i, color);
+}
+
+__attribute__((target("sse2"))) static void addSpanSSE2(Uint32* dst, int count, Uint32 color)
+{
+    __m128i source = _mm_set1_epi32((int)color);
+
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128((__m128i*)(dst + i));
+
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_adds_epu8(pixels, source));
+    }
+
+    addSpanScalar(dst + i, count - i, color);
+}
+
+__attribute__((target("sse2"))) static void overTexelsSSE2(Uint32* dst, const Uint32* texels, int count)
+{
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i source = _mm_loadu_si128((const __m128i*)(texels + i));
+
+        _mm_storeu_si128((__m128i*)(dst + i), overLanes(_mm_loadu_si128((__m128i*)(dst + i)), source));
+    }
+
+    overTexelsScalar(dst + i, texels + i, count - i);
+}
+
+__attribute__((target("sse2"))) static void addTexelsSSE2(Uint32* dst, const Uint32* texels, int count)
+{
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i source = _mm_loadu_si128((const __m128i*)(texels + i));
+
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_adds_epu8(_mm_loadu_si128((__m128i*)(dst + i)), source));
+    }
+
+    addTexelsScalar(dst + i, texels + i, count - i);
+}
+
+// storeRowScalar in stores of 4 pixels: the colour goes from the centre
+// outwards and may spill into the last 4 pixels of each side, which are then
+// written as one group of texels ending at extent. rows whose runs are longer
+// than 4 or reach the centre are left to storeRowScalar
+__attribute__((target("sse2"))) static void storeRowSSE2(Uint32* row, int centerX, int from, const CoverageRow* coverage,
+                                                        const Uint32* forward, const Uint32* backward, Uint32 color)
+{
+    int count = coverage->extent - coverage->solid;
+
+    if (count < 1 || count > 4 || coverage->solid < 3)
+    {
+        storeRowScalar(row, centerX, from, coverage, forward, backward, color);
+
+        return;
+    }
+
+    __m128i value = _mm_set1_epi32((int)color);
+
+    int last = coverage->extent - 4; // the last |dx| left to the colour
+
+    if (from == 0)
+    {
+        for (int dx = -last; dx <= last; dx += 4)
+        {
+            _mm_storeu_si128((__m128i*)(row + centerX + dx), value);
+        }
+    }
+    else
+    {
+        for (int dx = from; dx <= last; dx += 4)
+        {
+            _mm_storeu_si128((__m128i*)(row + centerX + dx), value);
+
+            _mm_storeu_si128((__m128i*)(row + centerX - dx - 3), value);
+        }
+    }
+
+    _mm_storeu_si128((__m128i*)(row + centerX + coverage->extent - 3), _mm_loadu_si128((const __m128i*)(forward + count - 4)));
+
+    _mm_storeu_si128((__m128i*)(row + centerX - coverage->extent), _mm_loadu_si128((const __m128i*)backward));
+}
+
+#endif
+
+typedef void (*SpanKernel)(Uint32* dst, int count, Uint32 color);
+
+typedef void (*TexelKernel)(Uint32* dst, const Uint32* texels, int count);
+
+typedef void (*RowKernel)(Uint32* row, int centerX, int from, const CoverageRow* coverage, const Uint32* forward, const Uint32* backward,
+                          Uint32 color);
+
+static SpanKernel overSpan = NULL;
+
+static SpanKernel addSpan = NULL;
+
+static TexelKernel overTexels = NULL;
+
+static TexelKernel addTexels = NULL;
+
+static RowKernel storeRow = NULL;
+
+static const char* spanKernelName = "scalar";
+
+static void chooseSpanKernels()
+{
+    overSpan = overSpanScalar;
+
+    addSpan = addSpanScalar;
+
+    overTexels = overTexelsScalar;
+
+    addTexels = addTexelsScalar;
+
+    storeRow = storeRowScalar;
+
+#ifdef CIRCLE_AA_X86
+    if (SDL_HasSSE2())
+    {
+        overSpan = overSpanSSE2;
+
+        addSpan = addSpanSSE2;
+
+        overTexels = overTexelsSSE2;
+
+        addTexels = addTexelsSSE2;
+
+        storeRow = storeRowSSE2;
+
+        spanKernelName = "sse2";
+    }
+#endif
+}
+
+const char* aaSpanKernel()
+{
+    if (overSpan == NULL)
+    {
+        chooseSpanKernels();
+    }
+
+    return spanKernelName;
+}
+
+// remade only when the colour changes, which costs a multiply per edge pixel
+static const EdgeTexels* edgeTexels(CoverageTable* table, Uint32 color)
+{
+    EdgeTexels* texels = &table->texels;
+
+    if (!texels->forward.empty() && texels->color == color)
+    {
+        return texels;
+    }
+
+    texels->color = color;
+
+    texels->forward.clear();
+
+    texels->backward.clear();
+
+    for (const CoverageRow& row : table->rows)
+    {
+        const Uint8* coverage = &table->coverage[row.offset];
+
+        int count = row.extent - row.solid;
+
+        texels->forward.insert(texels->forward.end(), AA_EDGE_PADDING, color);
+
+        texels->backward.insert(texels->backward.end(), AA_EDGE_PADDING, 0);
+
+        for (int i = 0; i < count; i++)
+        {
+            texels->forward.push_back(scalePixel(color, coverage[i]));
+
+            texels->backward.push_back(scalePixel(color, coverage[count - 1 - i]));
+        }
+
+        texels->forward.insert(texels->forward.end(), AA_EDGE_PADDING, 0);
+
+        texels->backward.insert(texels->backward.end(), AA_EDGE_PADDING, color);
+    }
+
+    return texels;
+}
+
+// a fully covered run of pixels: opaque colours are plain stores
+static void fillSpan(AaTarget* target, Uint32* row, int left, int right, Uint32 color, AaBlend blend)
+{
+    left = left < 0 ? 0 : left;
+
+    right = right >= target->width ? target->width - 1 : right;
+
+    if (left > right)
+    {
+        return;
+    }
+
+    if (blend == AA_ADD)
+    {
+        addSpan(row + left, right - left + 1, color);
+    }
+    else if (blend == AA_REPLACE || (color >> 24) == 255)
+    {
+        fillPixels(row + left, right - left + 1, color);
+    }
+    else
+    {
+        overSpan(row + left, right - left + 1, color);
+    }
+}
+
+// edge pixels left .. left + count - 1 of a row, with their texels
+static void blendEdge(AaTarget* target, Uint32* row, int left, const Uint32* texels, int count, AaBlend blend)
+{
+    if (left < 0)
+    {
+        texels -= left;
+
+        count += left;
+
+        left = 0;
+    }
+
+    count = left + count > target->width ? target->width - left : count;
+
+    if (count <= 0)
+    {
+        return;
+    }
+
+    if (blend == AA_REPLACE)
+    {
+        memcpy(row + left, texels, count * sizeof(Uint32));
+    }
+    else
+    {
+        (blend == AA_ADD ? addTexels : overTexels)(row + left, texels, count);
+    }
+}
+
+// the edge pixels |dx| = from .. to on both sides of the centre, forward holding
+// their texels by dx and backward the same from dx = to down, both padded with
+// AA_EDGE_PADDING transparent texels outwards. the runs are blended in whole
+// groups of 4, the pixels past a run are only rewritten
+static void blendEdges(AaTarget* target, Uint32* row, int centerX, int from, int to, const Uint32* forward, const Uint32* backward,
+                       AaBlend blend)
+{
+    if (from > to)
+    {
+        return;
+    }
+
+    int count = to - from + 1;
+
+    // the centre column is only blended once
+
+    int leftCount = from > 0 ? count : count - 1;
+
+    if (blend == AA_REPLACE)
+    {
+        blendEdge(target, row, centerX + from, forward, count, blend);
+
+        blendEdge(target, row, centerX - to, backward, leftCount, blend);
+
+        return;
+    }
+
+    int padding = -leftCount & 3;
+
+    blendEdge(target, row, centerX + from, forward, (count + 3) & ~3, blend);
+
+    blendEdge(target, row, centerX - to - padding, backward - padding, leftCount + padding, blend);
+}
+
+static std::vector<Uint32> ringTexels;
+
+// the edge pixels |dx| = from .. to of a ring row, the inner circle's coverage
+// taken from the outer one's
+static void blendRingEdges(AaTarget* target, Uint32* row, int centerX, int dy, int from, int to, const CoverageTable* outer,
+                           const CoverageTable* inner, Uint32 color, AaBlend blend)
+{
+    if (from > to)
+    {
+        return;
+    }
+
+    int count = to - from + 1;
+
+    // laid out like a table row: the run and its padding, then the padding and the run reversed
+
+    ringTexels.assign(2 * (count + AA_EDGE_PADDING), 0);
+
+    Uint32* forward = ringTexels.data();
+
+    Uint32* backward = forward + count + 2 * AA_EDGE_PADDING;
+
+    for (int dx = from; dx <= to; dx++)
+    {
+        int coverage = coverageAt(outer, dy, dx) - coverageAt(inner, dy, dx);
+
+        forward[dx - from] = scalePixel(color, (Uint32)(coverage > 0 ? coverage : 0));
+
+        backward[to - dx] = forward[dx - from];
+    }
+
+    blendEdges(target, row, centerX, from, to, forward, backward, blend);
+}
+
+// one row of a ring, the inner circle's pixels taken out of the outer one's
+static void drawAaRow(AaTarget* target, int y, int centerX, int dy, const CoverageTable* outer, const CoverageTable* inner,
+                      const EdgeTexels* texels, Uint32 color, AaBlend blend)
+{
+    const CoverageRow* outerRow = &outer->rows[dy];
+
+    if (y < 0 || y >= target->height || outerRow->extent < 0)
+    {
+        return;
+    }
+
+    Uint32* row = target->pixels + y * target->pitch;
+
+    const CoverageRow* innerRow = inner != NULL && dy <= inner->radius ? &inner->rows[dy] : NULL;
+
+    if (innerRow == NULL || innerRow->extent < 0 || blend == AA_REPLACE)
+    {
+        // a disc: one span and the edges straight from the table. a replaced
+        // ring is the outer disc without the inner one's fully covered middle
+
+        int from = innerRow != NULL && blend == AA_REPLACE ? innerRow->solid + 1 : 0;
+
+        if (from == 0 && outerRow->solid >= 0)
+        {
+            fillSpan(target, row, centerX - outerRow->solid, centerX + outerRow->solid, color, blend);
+        }
+        else if (from > 0 && from <= outerRow->solid)
+        {
+            fillSpan(target, row, centerX - outerRow->solid, centerX - from, color, blend);
+
+            fillSpan(target, row, centerX + from, centerX + outerRow->solid, color, blend);
+        }
+
+        int start = outerRow->offset + (2 * dy + 1) * AA_EDGE_PADDING;
+
+        blendEdges(target, row, centerX, outerRow->solid + 1, outerRow->extent, &texels->forward[start], &texels->backward[start], blend);
+
+        return;
+    }
+
+    // |dx| in first .. last is covered by the outer circle and untouched by the
+    // inner one; below first is the inner edge, above last the outer one
+
+    int first = innerRow->extent + 1, last = outerRow->solid;
+
+    if (first <= last)
+    {
+        fillSpan(target, row, centerX - last, centerX - first, color, blend);
+
+        fillSpan(target, row, centerX + first, centerX + last, color, blend);
+    }
+
+    // the edges of both meet or overlap when first > last
+
+    int from = innerRow->solid + 1, to = outerRow->extent;
+
+    if (first <= last)
+    {
+        blendRingEdges(target, row, centerX, dy, from, first - 1, outer, inner, color, blend);
+
+        blendRingEdges(target, row, centerX, dy, last + 1, to, outer, inner, color, blend);
+    }
+    else
+    {
+        blendRingEdges(target, row, centerX, dy, from, to, outer, inner, color, blend);
+    }
+}
+
+// by hand rather than with SDL_IntersectRect and SDL_UnionRect, it is done
+// for every circle and small ones take barely longer to draw
+static void markDirty(AaTarget* target, int centerX, int centerY, int radius)
+{
+    int left = SDL_max(centerX - radius, 0), right = SDL_min(centerX + radius + 1, target->width);
+
+    int top = SDL_max(centerY - radius, 0), bottom = SDL_min(centerY + radius + 1, target->height);
+
+    if (left >= right || top >= bottom)
+    {
+        return;
+    }
+
+    SDL_Rect* dirty = &target->dirty;
+
+    if (dirty->w > 0)
+    {
+        left = SDL_min(left, dirty->x);
+
+        top = SDL_min(top, dirty->y);
+
+        right = SDL_max(right, dirty->x + dirty->w);
+
+        bottom = SDL_max(bottom, dirty->y + dirty->h);
+    }
+
+    *dirty = {left, top, right - left, bottom - top};
+}
+
+void drawAaRing(AaTarget* target, int centerX, int centerY, int innerRadius, int outerRadius, SDL_Color color, AaBlend blend)
+{
+    if (outerRadius < 0 || innerRadius >= outerRadius || (color.a == 0 && blend != AA_REPLACE))
+    {
+        return;
+    }
+
+    if (overSpan == NULL)
+    {
+        chooseSpanKernels();
+    }
+
+    CoverageTable* outer = coverageTable(outerRadius);
+
+    const CoverageTable* inner = innerRadius >= 0 ? coverageTable(innerRadius) : NULL;
+
+    Uint32 premultiplied = premultiply(color);
+
+    const EdgeTexels* texels = edgeTexels(outer, premultiplied);
+
+    // a replaced disc or ring fully on the target is all stores, no clipping or blending
+
+    bool stores = blend == AA_REPLACE
+               && centerX - outerRadius >= 0 && centerX + outerRadius < target->width
+               && centerY - outerRadius >= 0 && centerY + outerRadius < target->height;
+
+    for (int dy = 0; dy <= outerRadius; dy++)
+    {
+        if (stores)
+        {
+            const CoverageRow* row = &outer->rows[dy];
+
+            int from = inner != NULL && dy <= innerRadius ? inner->rows[dy].solid + 1 : 0;
+
+            int start = row->offset + (2 * dy + 1) * AA_EDGE_PADDING;
+
+            storeRow(target->pixels + (centerY - dy) * target->pitch, centerX, from, row, &texels->forward[start], &texels->backward[start], premultiplied);
+
+            if (dy > 0)
+            {
+                storeRow(target->pixels + (centerY + dy) * target->pitch, centerX, from, row, &texels->forward[start], &texels->backward[start],
+                         premultiplied);
+            }
+
+            continue;
+        }
+
+        drawAaRow(target, centerY - dy, centerX, dy, outer, inner, texels, premultiplied, blend);
+
+        if (dy > 0)
+        {
+            drawAaRow(target, centerY + dy, centerX, dy, outer, inner, texels, premultiplied, blend);
+        }
+    }
+
+    markDirty(target, centerX, centerY, outerRadius);
+}
+
+void drawAaCircle(AaTarget* target, int centerX, int centerY, int radius, SDL_Color color, AaBlend blend)
+{
+    drawAaRing(target, centerX, centerY, -1, radius, color, blend);
+}
+
+bool createAaCanvas(AaCanvas* canvas, SDL_Renderer* renderer, int width, int height)
+{
+    canvas->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
+
+    if (canvas->texture == NULL)
+    {
+        printf("Anti-aliasing canvas creation failed: %s\n", SDL_GetError());
+
+        return false;
+    }
+
+    SDL_BlendMode premultiplied = SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+                                                             SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+
+    canvas->blended = SDL_SetTextureBlendMode(canvas->texture, premultiplied) == 0;
+
+    if (!canvas->blended)
+    {
+        SDL_SetTextureBlendMode(canvas->texture, SDL_BLENDMODE_NONE);
+    }
+
+    canvas->pixels.assign((size_t)width * height, 0);
+
+    canvas->target = {canvas->pixels.data(), width, width, height, {0, 0, width, height}};
+
+    return true;
+}
+
+void destroyAaCanvas(AaCanvas* canvas)
+{
+    SDL_DestroyTexture(canvas->texture);
+
+    canvas->texture = NULL;
+}
+
+void clearAaCanvas(AaCanvas* canvas, SDL_Color color)
+{
+    fillPixels(canvas->pixels.data(), (int)canvas->pixels.size(), premultiply(color));
+
+    canvas->target.dirty = {0, 0, canvas->target.width, canvas->target.height};
+}
+
+void presentAaCanvas(SDL_Renderer* renderer, AaCanvas* canvas, const SDL_Rect* destination)
+{
+    AaTarget* target = &canvas->target;
+
+    if (target->dirty.w > 0)
+    {
+        const Uint32* first = target->pixels + target->dirty.y * target->pitch + target->dirty.x;
+
+        SDL_UpdateTexture(canvas->texture, &target->dirty, first, target->pitch * (int)sizeof(Uint32));
+
+        target->dirty = {0, 0, 0, 0};
+    }
+
+    SDL_RenderCopy(renderer, canvas->texture, NULL, destination);
+
+    circleRenderCalls++;
+}
@@ -0,0 +1,170 @@
+#include "circle_cache.h"
+#include "circle.h"
+#include <stdio.h>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+typedef struct CircleSprite
+{
+    Uint64 key;
+    SDL_Texture* texture;
+    size_t bytes;
+} CircleSprite;
+
+static std::list<CircleSprite> sprites; // front is the most recently used
+
+static std::unordered_map<Uint64, std::list<CircleSprite>::iterator> spriteIndex;
+
+static SDL_Renderer* cacheRenderer = NULL;
+
+static size_t cacheBudget = CIRCLE_CACHE_BUDGET;
+
+static CircleCacheStats stats = {0, 0, 0, 0, 0};
+
+static void evictSprites(size_t limit)
+{
+    while (stats.bytes > limit && !sprites.empty())
+    {
+        CircleSprite& oldest = sprites.back();
+
+        SDL_DestroyTexture(oldest.texture);
+
+        stats.bytes -= oldest.bytes;
+
+        stats.sprites--;
+
+        stats.evictions++;
+
+        spriteIndex.erase(oldest.key);
+
+        sprites.pop_back();
+    }
+}
+
+static SDL_Texture* createCircleTexture(SDL_Renderer* renderer, int radius, Uint32 argb)
+{
+    int size = 2 * radius + 1;
+
+    SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, size, size);
+
+    if (texture == NULL)
+    {
+        printf("Circle texture creation failed: %s\n", SDL_GetError());
+
+        return NULL;
+    }
+
+    std::vector<Uint32> pixels(size * size, 0);
+
+    const int* halfWidths = circleSpans(radius);
+
+    for (int y = 0; y <= radius; y++)
+    {
+        Uint32* top = &pixels[(radius - y) * size];
+
+        Uint32* bottom = &pixels[(radius + y) * size];
+
+        for (int x = radius - halfWidths[y]; x <= radius + halfWidths[y]; x++)
+        {
+            top[x] = argb;
+
+            bottom[x] = argb;
+        }
+    }
+
+    SDL_UpdateTexture(texture, NULL, pixels.data(), size * (int)sizeof(Uint32));
+
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    return texture;
+}
+
+void drawCachedCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius)
+{
+    if (radius < 0)
+    {
+        return;
+    }
+
+    if (renderer != cacheRenderer)
+    {
+        clearCircleCache();
+
+        cacheRenderer = renderer;
+    }
+
+    Uint8 r, g, b, a;
+
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+
+    Uint32 argb = ((Uint32)a << 24) | ((Uint32)r << 16) | ((Uint32)g << 8) | b;
+
+    Uint64 key = ((Uint64)radius << 32) | argb;
+
+    SDL_Texture* texture;
+
+    auto found = spriteIndex.find(key);
+
+    if (found != spriteIndex.end())
+    {
+        stats.hits++;
+
+        sprites.splice(sprites.begin(), sprites, found->second);
+
+        texture = found->second->texture;
+    }
+    else
+    {
+        stats.misses++;
+
+        texture = createCircleTexture(renderer, radius, argb);
+
+        if (texture == NULL)
+        {
+            return;
+        }
+
+        size_t bytes = (size_t)(2 * radius + 1) * (2 * radius + 1) * sizeof(Uint32);
+
+        // make room first so a sprite bigger than the budget still gets drawn once
+        evictSprites(bytes < cacheBudget ? cacheBudget - bytes : 0);
+
+        sprites.push_front({key, texture, bytes});
+
+        spriteIndex[key] = sprites.begin();
+
+        stats.bytes += bytes;
+
+        stats.sprites++;
+    }
+
+    SDL_Rect destination = {centerX - radius, centerY - radius, 2 * radius + 1, 2 * radius + 1};
+
+    SDL_RenderCopy(renderer, texture, NULL, &destination);
+
+    circleRenderCalls++;
+}
+
+void setCircleCacheBudget(size_t bytes)
+{
+    cacheBudget = bytes;
+
+    evictSprites(cacheBudget);
+}
+
+CircleCacheStats getCircleCacheStats()
+{
+    return stats;
+}
+
+void printCircleCacheStats()
+{
+    printf("circle cache: %ld hits, %ld misses, %ld evictions, %d sprites, %zu bytes\n",
+           stats.hits, stats.misses, stats.evictions, stats.sprites, stats.bytes);
+}
+
+void clearCircleCache()
+{
+    evictSprites(0);
+}
@@ -0,0 +1,32 @@
+#ifndef CIRCLE_CACHE_H
+#define CIRCLE_CACHE_H
+
+#include <SDL2/SDL.h>
+#include <stddef.h>
+
+#define CIRCLE_CACHE_BUDGET (4 * 1024 * 1024) // default texture memory budget in bytes
+
+typedef struct CircleCacheStats
+{
+    long hits;
+    long misses;
+    long evictions;
+    size_t bytes;
+    int sprites;
+} CircleCacheStats;
+
+// filled circle in the current draw color, rasterized once per (radius, color)
+// into a texture and then drawn with a single SDL_RenderCopy
+void drawCachedCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius);
+
+// least recently used sprites are dropped once the budget is exceeded
+void setCircleCacheBudget(size_t bytes);
+
+CircleCacheStats getCircleCacheStats();
+
+void printCircleCacheStats();
+
+// destroys all cached textures, call before destroying the renderer
+void clearCircleCache();
+
+#endif
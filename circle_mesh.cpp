@@ -0,0 +1,129 @@
+#include "circle_mesh.h"
+#include "circle.h"
+#include <math.h>
+#include <vector>
+
+#define CIRCLE_MESH_MIN_SEGMENTS 4
+
+typedef struct MeshTemplate
+{
+    int segments;
+    float maxRadius; // largest radius this many segments draw within CIRCLE_MESH_MAX_ERROR
+    std::vector<SDL_FPoint> rim; // one point per segment around a unit circle
+    std::vector<int> indices; // fan around vertex 0, the rim starting at 1
+} MeshTemplate;
+
+static std::vector<MeshTemplate> templates;
+
+static std::vector<SDL_Vertex> vertices;
+
+static std::vector<int> indices;
+
+static void buildTemplates()
+{
+    for (int segments = CIRCLE_MESH_MIN_SEGMENTS; segments <= CIRCLE_MESH_MAX_SEGMENTS; segments *= 2)
+    {
+        MeshTemplate level;
+
+        level.segments = segments;
+
+        // a chord of an n-gon sags r * (1 - cos(pi / n)) inside the circle; the
+        // rim is pushed out by half of that so the edges cross the circle
+        // instead of all lying inside it
+
+        double cosine = cos(M_PI / segments);
+
+        level.maxRadius = CIRCLE_MESH_MAX_ERROR / (float)(1.0 - cosine);
+
+        double scale = 2.0 / (1.0 + cosine);
+
+        for (int i = 0; i < segments; i++)
+        {
+            double angle = 2.0 * M_PI * i / segments;
+
+            level.rim.push_back({(float)(scale * cos(angle)), (float)(scale * sin(angle))});
+
+            level.indices.push_back(0);
+
+            level.indices.push_back(i + 1);
+
+            level.indices.push_back(i + 1 < segments ? i + 2 : 1);
+        }
+
+        templates.push_back(level);
+    }
+}
+
+static const MeshTemplate* chooseTemplate(float radius)
+{
+    if (templates.empty())
+    {
+        buildTemplates();
+    }
+
+    for (const MeshTemplate& level : templates)
+    {
+        if (radius <= level.maxRadius)
+        {
+            return &level;
+        }
+    }
+
+    return &templates.back(); // past CIRCLE_MESH_MAX_SEGMENTS the edge error grows
+}
+
+void addMeshCircle(float centerX, float centerY, float radius, SDL_Color color)
+{
+    if (radius < 0.0f)
+    {
+        return;
+    }
+
+    // pixel (x, y) covers x..x+1 in render coordinates, so the circle is drawn
+    // around the pixel's middle. a pixel dx, dy away is in when dx*dx + dy*dy
+    // <= radius*radius, and the next distance out is sqrt(radius*radius + 1),
+    // so the edge goes halfway between the two
+
+    float x = centerX + 0.5f, y = centerY + 0.5f, r = 0.5f * (radius + sqrtf(radius * radius + 1.0f));
+
+    const MeshTemplate* level = chooseTemplate(r);
+
+    int base = (int)vertices.size();
+
+    vertices.push_back({{x, y}, color, {0.0f, 0.0f}});
+
+    for (const SDL_FPoint& point : level->rim)
+    {
+        vertices.push_back({{x + r * point.x, y + r * point.y}, color, {0.0f, 0.0f}});
+    }
+
+    for (int index : level->indices)
+    {
+        indices.push_back(base + index);
+    }
+}
+
+void drawMeshCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius)
+{
+    SDL_Color color;
+
+    SDL_GetRenderDrawColor(renderer, &color.r, &color.g, &color.b, &color.a);
+
+    addMeshCircle((float)centerX, (float)centerY, (float)radius, color);
+}
+
+void flushCircleMesh(SDL_Renderer* renderer)
+{
+    if (indices.empty())
+    {
+        return;
+    }
+
+    SDL_RenderGeometry(renderer, NULL, vertices.data(), (int)vertices.size(), indices.data(), (int)indices.size());
+
+    circleRenderCalls++;
+
+    vertices.clear();
+
+    indices.clear();
+}
@@ -0,0 +1,26 @@
+#ifndef CIRCLE_MESH_H
+#define CIRCLE_MESH_H
+
+#include <SDL2/SDL.h>
+
+// filled circles as triangle fans, collected over a frame and drawn with one
+// SDL_RenderGeometry call. the number of segments is picked per radius from
+// precomputed unit circle templates (4, 8, ... CIRCLE_MESH_MAX_SEGMENTS), the
+// fewest that keep every chord within CIRCLE_MESH_MAX_ERROR of the circle
+
+#define CIRCLE_MESH_MAX_ERROR 0.5f // pixels
+#define CIRCLE_MESH_MAX_SEGMENTS 256 // enough up to a radius of about 6600
+
+// queues a circle in the same pixels as drawSolidCircle would cover, a pixel
+// being in when its centre is; nothing is drawn before flushCircleMesh
+void addMeshCircle(float centerX, float centerY, float radius, SDL_Color color);
+
+// addMeshCircle in the current draw color, a CircleDrawer (--mesh)
+void drawMeshCircle(SDL_Renderer* renderer, int centerX, int centerY, int radius);
+
+// draws every circle queued since the last flush in one call; the queued
+// circles use the render target and clip rect current at the flush, so call
+// it before changing those, and before presenting. nothing queued, no call
+void flushCircleMesh(SDL_Renderer* renderer);
+
+#endif
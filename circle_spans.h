@@ -0,0 +1,58 @@
+#ifndef CIRCLE_SPANS_H
+#define CIRCLE_SPANS_H
+
+// the half width of every row of a filled circle, row y spanning
+// centerX - halfWidths[y] .. centerX + halfWidths[y]. CircleSpans<R> builds the
+// table for a radius known at compile time into the program's data, so drawing
+// that circle is only a walk over it (drawFixedCircle<R> in circle.h);
+// circleSpans keeps a computed table for any radius
+
+// midpoint style walk: x only ever shrinks as y grows, so the
+// x*x + y*y <= radius*radius test is kept without any sqrt
+constexpr void walkCircleSpans(int radius, int* halfWidths)
+{
+    int x = radius;
+
+    int error = 0; // radius*radius - x*x - y*y
+
+    for (int y = 0; y <= radius; y++)
+    {
+        while (error < 0)
+        {
+            error += 2 * x - 1;
+
+            x--;
+        }
+
+        halfWidths[y] = x;
+
+        error -= 2 * y + 1;
+    }
+}
+
+template <int R>
+struct CircleSpans
+{
+    static_assert(R >= 0, "a circle needs a radius of at least 0");
+
+    int halfWidths[R + 1];
+
+    constexpr CircleSpans() : halfWidths()
+    {
+        walkCircleSpans(R, halfWidths);
+    }
+};
+
+// one table per radius for the whole program, built by the compiler
+template <int R>
+const int* fixedCircleSpans()
+{
+    static constexpr CircleSpans<R> spans;
+
+    return spans.halfWidths;
+}
+
+static_assert(CircleSpans<2>().halfWidths[0] == 2 && CircleSpans<2>().halfWidths[1] == 1 && CircleSpans<2>().halfWidths[2] == 0,
+              "the compile time walk should match x*x + y*y <= radius*radius");
+
+#endif
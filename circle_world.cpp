@@ -0,0 +1,176 @@
+#include "circle_world.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CIRCLE_WORLD_X86 1
+#include <immintrin.h>
+#endif
+
+int addCircle(CircleWorld* world, float x, float y, float r, float vx, float vy)
+{
+    world->x.push_back(x);
+
+    world->y.push_back(y);
+
+    world->r.push_back(r);
+
+    world->vx.push_back(vx);
+
+    world->vy.push_back(vy);
+
+    return (int)world->x.size() - 1;
+}
+
+int circleCount(const CircleWorld* world)
+{
+    return (int)world->x.size();
+}
+
+void moveCircles(CircleWorld* world, float width, float height)
+{
+    int count = circleCount(world);
+
+    float* x = world->x.data();
+
+    float* y = world->y.data();
+
+    float* vx = world->vx.data();
+
+    float* vy = world->vy.data();
+
+    for (int i = 0; i < count; i++)
+    {
+        x[i] += vx[i];
+
+        y[i] += vy[i];
+
+        if (x[i] < 0.0f || x[i] >= width)
+        {
+            vx[i] = -vx[i];
+
+            x[i] += 2.0f * vx[i];
+        }
+
+        if (y[i] < 0.0f || y[i] >= height)
+        {
+            vy[i] = -vy[i];
+
+            y[i] += 2.0f * vy[i];
+        }
+    }
+}
+
+int findOverlapsScalar(float x, float y, float r, const float* xs, const float* ys, const float* rs, int begin, int end, int* hits)
+{
+    int found = 0;
+
+    for (int i = begin; i < end; i++)
+    {
+        float dx = x - xs[i];
+
+        float dy = y - ys[i];
+
+        float combinedRadius = r + rs[i];
+
+        // always write, only keep it when it hit
+        hits[found] = i;
+
+        found += dx * dx + dy * dy <= combinedRadius * combinedRadius;
+    }
+
+    return found;
+}
+
+#ifdef CIRCLE_WORLD_X86
+
+__attribute__((target("avx2"))) int findOverlapsAVX2(float x, float y, float r, const float* xs, const float* ys, const float* rs, int begin, int end, int* hits)
+{
+    __m256 centerX = _mm256_set1_ps(x);
+
+    __m256 centerY = _mm256_set1_ps(y);
+
+    __m256 radius = _mm256_set1_ps(r);
+
+    __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    int found = 0;
+
+    for (int i = begin; i < end; i += 8)
+    {
+        __m256 dx, dy, combinedRadius;
+
+        int remaining = end - i;
+
+        if (remaining >= 8)
+        {
+            dx = _mm256_sub_ps(centerX, _mm256_loadu_ps(xs + i));
+
+            dy = _mm256_sub_ps(centerY, _mm256_loadu_ps(ys + i));
+
+            combinedRadius = _mm256_add_ps(radius, _mm256_loadu_ps(rs + i));
+        }
+        else
+        {
+            // masked loads never touch memory past end
+            __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(remaining), lanes);
+
+            dx = _mm256_sub_ps(centerX, _mm256_maskload_ps(xs + i, mask));
+
+            dy = _mm256_sub_ps(centerY, _mm256_maskload_ps(ys + i, mask));
+
+            combinedRadius = _mm256_add_ps(radius, _mm256_maskload_ps(rs + i, mask));
+        }
+
+        __m256 distanceSquared = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+        __m256 hit = _mm256_cmp_ps(distanceSquared, _mm256_mul_ps(combinedRadius, combinedRadius), _CMP_LE_OQ);
+
+        unsigned bits = (unsigned)_mm256_movemask_ps(hit);
+
+        if (remaining < 8)
+        {
+            bits &= (1u << remaining) - 1;
+        }
+
+        while (bits != 0)
+        {
+            hits[found++] = i + __builtin_ctz(bits);
+
+            bits &= bits - 1;
+        }
+    }
+
+    return found;
+}
+
+bool hasOverlapKernelAVX2()
+{
+    return __builtin_cpu_supports("avx2");
+}
+
+#else
+
+int findOverlapsAVX2(float x, float y, float r, const float* xs, const float* ys, const float* rs, int begin, int end, int* hits)
+{
+    return findOverlapsScalar(x, y, r, xs, ys, rs, begin, end, hits);
+}
+
+bool hasOverlapKernelAVX2()
+{
+    return false;
+}
+
+#endif
+
+OverlapKernel chooseOverlapKernel(const char** name)
+{
+    if (hasOverlapKernelAVX2())
+    {
+        *name = "avx2";
+
+        return findOverlapsAVX2;
+    }
+
+    *name = "scalar";
+
+    return findOverlapsScalar;
+}
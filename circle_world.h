@@ -0,0 +1,36 @@
+#ifndef CIRCLE_WORLD_H
+#define CIRCLE_WORLD_H
+
+#include <vector>
+
+// circle state as structure of arrays so the narrow phase can load 8 circles at once
+typedef struct CircleWorld
+{
+    std::vector<float> x, y;
+    std::vector<float> r;
+    std::vector<float> vx, vy;
+} CircleWorld;
+
+// returns the index of the new circle
+int addCircle(CircleWorld* world, float x, float y, float r, float vx, float vy);
+
+int circleCount(const CircleWorld* world);
+
+// advances every circle by its velocity, bouncing off the edges of [0, width) x [0, height)
+void moveCircles(CircleWorld* world, float width, float height);
+
+// narrow phase: writes the indices in [begin, end) whose circle overlaps the
+// circle (x, y, r) to hits (room for end - begin entries), returns how many
+typedef int (*OverlapKernel)(float x, float y, float r, const float* xs, const float* ys, const float* rs, int begin, int end, int* hits);
+
+int findOverlapsScalar(float x, float y, float r, const float* xs, const float* ys, const float* rs, int begin, int end, int* hits);
+
+// tests 8 candidates per instruction, only call it when hasOverlapKernelAVX2() is true
+int findOverlapsAVX2(float x, float y, float r, const float* xs, const float* ys, const float* rs, int begin, int end, int* hits);
+
+bool hasOverlapKernelAVX2();
+
+// the fastest kernel this CPU supports
+OverlapKernel chooseOverlapKernel(const char** name);
+
+#endif
@@ -0,0 +1,181 @@
+#include "collision_grid.h"
+
+static int clampCell(int cell, int limit)
+{
+    if (cell < 0)
+    {
+        return 0;
+    }
+
+    return cell >= limit ? limit - 1 : cell;
+}
+
+void buildCollisionGrid(CollisionGrid* grid, const CircleWorld* world, float width, float height, float cellSize)
+{
+    int count = circleCount(world);
+
+    grid->cellSize = cellSize;
+
+    grid->columns = (int)(width / cellSize) + 1;
+
+    grid->rows = (int)(height / cellSize) + 1;
+
+    int cells = grid->columns * grid->rows;
+
+    grid->cellStart.assign(cells + 1, 0);
+
+    grid->cellItems.resize(count);
+
+    grid->circleCell.resize(count);
+
+    grid->sortedX.resize(count);
+
+    grid->sortedY.resize(count);
+
+    grid->sortedR.resize(count);
+
+    float scale = 1.0f / cellSize;
+
+    // count circles per cell
+
+    for (int i = 0; i < count; i++)
+    {
+        int column = clampCell((int)(world->x[i] * scale), grid->columns);
+
+        int row = clampCell((int)(world->y[i] * scale), grid->rows);
+
+        int cell = row * grid->columns + column;
+
+        grid->circleCell[i] = cell;
+
+        grid->cellStart[cell + 1]++;
+    }
+
+    // prefix sum turns the counts into start offsets
+
+    for (int cell = 0; cell < cells; cell++)
+    {
+        grid->cellStart[cell + 1] += grid->cellStart[cell];
+    }
+
+    // scatter, using cellStart as the write cursor and shifting it back afterwards
+
+    for (int i = 0; i < count; i++)
+    {
+        grid->cellItems[grid->cellStart[grid->circleCell[i]]++] = i;
+    }
+
+    for (int cell = cells; cell > 0; cell--)
+    {
+        grid->cellStart[cell] = grid->cellStart[cell - 1];
+    }
+
+    grid->cellStart[0] = 0;
+
+    // gather the circles into cell order so neighbouring cells are contiguous
+
+    for (int slot = 0; slot < count; slot++)
+    {
+        int i = grid->cellItems[slot];
+
+        grid->sortedX[slot] = world->x[i];
+
+        grid->sortedY[slot] = world->y[i];
+
+        grid->sortedR[slot] = world->r[i];
+    }
+}
+
+static void testRange(CollisionGrid* grid, OverlapKernel kernel, int slot, int begin, int end, std::vector<CollisionPair>* hits, CollisionStats* stats)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    int* found = grid->hitBuffer.data();
+
+    int hitCount = kernel(grid->sortedX[slot], grid->sortedY[slot], grid->sortedR[slot],
+                          grid->sortedX.data(), grid->sortedY.data(), grid->sortedR.data(), begin, end, found);
+
+    stats->pairsTested += end - begin;
+
+    stats->pairsHit += hitCount;
+
+    for (int k = 0; k < hitCount; k++)
+    {
+        int i = grid->cellItems[slot];
+
+        int j = grid->cellItems[found[k]];
+
+        hits->push_back(i < j ? CollisionPair{i, j} : CollisionPair{j, i});
+    }
+}
+
+void findCollisions(CollisionGrid* grid, OverlapKernel kernel, std::vector<CollisionPair>* hits, CollisionStats* stats)
+{
+    // each cell is paired with itself and the four neighbours after it
+    // (right, below left, below, below right) so every pair is seen once;
+    // sorted by cell, the rest of a cell plus the cell to its right and the
+    // three cells below are two contiguous runs for the kernel
+
+    grid->hitBuffer.resize(grid->cellItems.size());
+
+    for (int row = 0; row < grid->rows; row++)
+    {
+        for (int column = 0; column < grid->columns; column++)
+        {
+            int cell = row * grid->columns + column;
+
+            int start = grid->cellStart[cell];
+
+            int end = grid->cellStart[cell + 1];
+
+            if (start == end)
+            {
+                continue;
+            }
+
+            int sameEnd = column + 1 < grid->columns ? grid->cellStart[cell + 2] : end;
+
+            int belowBegin = 0, belowEnd = 0;
+
+            if (row + 1 < grid->rows)
+            {
+                int below = cell + grid->columns;
+
+                belowBegin = grid->cellStart[column > 0 ? below - 1 : below];
+
+                belowEnd = grid->cellStart[column + 1 < grid->columns ? below + 2 : below + 1];
+            }
+
+            for (int slot = start; slot < end; slot++)
+            {
+                testRange(grid, kernel, slot, slot + 1, sameEnd, hits, stats);
+
+                testRange(grid, kernel, slot, belowBegin, belowEnd, hits, stats);
+            }
+        }
+    }
+}
+
+void findCollisionsBruteForce(const CircleWorld* world, OverlapKernel kernel, std::vector<CollisionPair>* hits, CollisionStats* stats)
+{
+    int count = circleCount(world);
+
+    std::vector<int> found(count);
+
+    for (int i = 0; i < count; i++)
+    {
+        int hitCount = kernel(world->x[i], world->y[i], world->r[i], world->x.data(), world->y.data(), world->r.data(), i + 1, count, found.data());
+
+        stats->pairsTested += count - i - 1;
+
+        stats->pairsHit += hitCount;
+
+        for (int k = 0; k < hitCount; k++)
+        {
+            hits->push_back({i, found[k]});
+        }
+    }
+}
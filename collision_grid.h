@@ -0,0 +1,41 @@
+#ifndef COLLISION_GRID_H
+#define COLLISION_GRID_H
+
+#include <vector>
+#include "circle_world.h"
+
+typedef struct CollisionPair
+{
+    int first, second;
+} CollisionPair;
+
+// uniform grid over [0, width) x [0, height), every circle is filed under the
+// cell holding its center; rebuilt from scratch each frame with a counting sort
+typedef struct CollisionGrid
+{
+    float cellSize;
+    int columns, rows;
+    std::vector<int> cellStart; // columns * rows + 1 offsets into cellItems
+    std::vector<int> cellItems; // circle indices grouped by cell
+    std::vector<int> circleCell;
+    std::vector<float> sortedX, sortedY, sortedR; // circles copied in cellItems order
+    std::vector<int> hitBuffer;
+} CollisionGrid;
+
+typedef struct CollisionStats
+{
+    long pairsTested;
+    long pairsHit;
+} CollisionStats;
+
+// cellSize must be at least the largest circle diameter so that touching
+// circles always sit in the same or neighbouring cells
+void buildCollisionGrid(CollisionGrid* grid, const CircleWorld* world, float width, float height, float cellSize);
+
+// appends every overlapping pair once (first < second) to hits
+void findCollisions(CollisionGrid* grid, OverlapKernel kernel, std::vector<CollisionPair>* hits, CollisionStats* stats);
+
+// reference O(n^2) version used to check the grid
+void findCollisionsBruteForce(const CircleWorld* world, OverlapKernel kernel, std::vector<CollisionPair>* hits, CollisionStats* stats);
+
+#endif
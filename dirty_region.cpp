@@ -0,0 +1,213 @@
+#include "dirty_region.h"
+#include <stdio.h>
+#include "render_backend.h"
+
+bool createDirtyRegion(DirtyRegion* region, SDL_Renderer* renderer, int width, int height)
+{
+    region->canvas = NULL;
+
+    if (!rendererKeepsFrame(renderer))
+    {
+        region->canvas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+
+        if (region->canvas == NULL)
+        {
+            printf("Canvas creation failed: %s\n", SDL_GetError());
+
+            return false;
+        }
+    }
+
+    region->width = width;
+
+    region->height = height;
+
+    region->rects.clear();
+
+    region->full = true;
+
+    region->clip = -1;
+
+    region->pixelsTouched = 0;
+
+    return true;
+}
+
+void destroyDirtyRegion(DirtyRegion* region)
+{
+    if (region->canvas != NULL)
+    {
+        SDL_DestroyTexture(region->canvas);
+    }
+
+    region->canvas = NULL;
+}
+
+void markDirty(DirtyRegion* region, const SDL_Rect* previous, const SDL_Rect* current)
+{
+    if (region->full)
+    {
+        return;
+    }
+
+    SDL_Rect screen = {0, 0, region->width, region->height};
+
+    SDL_Rect both = {0, 0, 0, 0};
+
+    if (previous != NULL)
+    {
+        SDL_UnionRect(&both, previous, &both);
+    }
+
+    if (current != NULL)
+    {
+        SDL_UnionRect(&both, current, &both);
+    }
+
+    SDL_Rect visible;
+
+    if (SDL_IntersectRect(&both, &screen, &visible))
+    {
+        region->rects.push_back(visible);
+    }
+}
+
+void markAllDirty(DirtyRegion* region)
+{
+    region->full = true;
+}
+
+static long rectArea(const SDL_Rect* rect)
+{
+    return (long)rect->w * rect->h;
+}
+
+// overlapping rects would be cleared and drawn into twice, so they become one
+static void mergeRects(std::vector<SDL_Rect>* rects)
+{
+    for (size_t i = 0; i < rects->size(); i++)
+    {
+        for (size_t j = i + 1; j < rects->size(); j++)
+        {
+            if (SDL_HasIntersection(&(*rects)[i], &(*rects)[j]))
+            {
+                SDL_UnionRect(&(*rects)[i], &(*rects)[j], &(*rects)[i]);
+
+                rects->erase(rects->begin() + j);
+
+                // the grown rect may now reach ones already passed
+
+                j = i;
+            }
+        }
+    }
+
+    if (rects->size() > DIRTY_MAX_RECTS)
+    {
+        for (size_t i = 1; i < rects->size(); i++)
+        {
+            SDL_UnionRect(&(*rects)[0], &(*rects)[i], &(*rects)[0]);
+        }
+
+        rects->resize(1);
+    }
+}
+
+int beginDirtyRedraw(SDL_Renderer* renderer, DirtyRegion* region, const SDL_Color* background)
+{
+    region->pixelsTouched = 0;
+
+    if (!region->full)
+    {
+        mergeRects(&region->rects);
+
+        long area = 0;
+
+        for (const SDL_Rect& rect : region->rects)
+        {
+            area += rectArea(&rect);
+        }
+
+        region->full = area > (long)(DIRTY_FULL_REDRAW_FRACTION * region->width * region->height);
+    }
+
+    if (region->full)
+    {
+        region->rects.assign(1, {0, 0, region->width, region->height});
+    }
+
+    if (region->rects.empty())
+    {
+        return 0;
+    }
+
+    if (region->canvas != NULL)
+    {
+        SDL_SetRenderTarget(renderer, region->canvas);
+    }
+
+    SDL_SetRenderDrawColor(renderer, background->r, background->g, background->b, background->a);
+
+    if (region->full)
+    {
+        renderClear(renderer);
+    }
+    else
+    {
+        renderFillRects(renderer, region->rects.data(), (int)region->rects.size());
+    }
+
+    for (const SDL_Rect& rect : region->rects)
+    {
+        region->pixelsTouched += rectArea(&rect);
+    }
+
+    return (int)region->rects.size();
+}
+
+bool dirtyRectOverlaps(SDL_Renderer* renderer, DirtyRegion* region, int i, const SDL_Rect* bounds)
+{
+    SDL_Rect overlap;
+
+    if (!SDL_IntersectRect(bounds, &region->rects[i], &overlap))
+    {
+        return false;
+    }
+
+    // a full redraw needs no clip, which keeps the software fills direct
+
+    if (!region->full && region->clip != i)
+    {
+        SDL_RenderSetClipRect(renderer, &region->rects[i]);
+
+        region->clip = i;
+    }
+
+    region->pixelsTouched += rectArea(&overlap);
+
+    return true;
+}
+
+void endDirtyRedraw(SDL_Renderer* renderer, DirtyRegion* region)
+{
+    if (region->clip >= 0)
+    {
+        SDL_RenderSetClipRect(renderer, NULL);
+
+        region->clip = -1;
+    }
+
+    if (region->canvas != NULL)
+    {
+        if (!region->rects.empty())
+        {
+            SDL_SetRenderTarget(renderer, NULL);
+        }
+
+        SDL_RenderCopy(renderer, region->canvas, NULL, NULL);
+    }
+
+    region->rects.clear();
+
+    region->full = false;
+}
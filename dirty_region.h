@@ -0,0 +1,52 @@
+#ifndef DIRTY_REGION_H
+#define DIRTY_REGION_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// redraws only the parts of the screen that changed since the last frame.
+// what is on screen has to survive the present, so drawing goes into a
+// target texture that is copied to the window, except on the software
+// backend whose frame already keeps its pixels. a frame goes:
+//
+//   markDirty(...) for everything that moved or changed
+//   int count = beginDirtyRedraw(renderer, region, &background);
+//   for each i < count: dirtyRectOverlaps(region, i, &bounds) -> draw it
+//   endDirtyRedraw(renderer, region);
+
+#define DIRTY_FULL_REDRAW_FRACTION 0.5f // above this share of the screen one clear is cheaper
+#define DIRTY_MAX_RECTS 8 // more than this and they are merged into their bounding box
+
+typedef struct DirtyRegion
+{
+    SDL_Texture* canvas; // NULL when the renderer keeps its frame
+    int width, height;
+    std::vector<SDL_Rect> rects; // clipped to the screen, merged where they overlap
+    bool full; // everything is redrawn, nothing on the canvas is valid
+    int clip; // rect the renderer is clipped to, -1 for none
+    long pixelsTouched; // cleared plus drawn over this frame, bounding boxes for drawn
+                        // shapes; the copy of the canvas to the window is not counted
+} DirtyRegion;
+
+bool createDirtyRegion(DirtyRegion* region, SDL_Renderer* renderer, int width, int height);
+
+void destroyDirtyRegion(DirtyRegion* region);
+
+// previous and current bounds of something that moved, either may be NULL
+void markDirty(DirtyRegion* region, const SDL_Rect* previous, const SDL_Rect* current);
+
+// after a render target reset, the canvas contents are gone
+void markAllDirty(DirtyRegion* region);
+
+// points drawing at the canvas and clears the dirty rects to background;
+// returns how many rects there are to redraw, 0 when nothing changed
+int beginDirtyRedraw(SDL_Renderer* renderer, DirtyRegion* region, const SDL_Color* background);
+
+// true when bounds reaches into dirty rect i; the renderer is then clipped to
+// that rect and the overlap is counted as touched
+bool dirtyRectOverlaps(SDL_Renderer* renderer, DirtyRegion* region, int i, const SDL_Rect* bounds);
+
+// removes the clip and puts the canvas on the screen
+void endDirtyRedraw(SDL_Renderer* renderer, DirtyRegion* region);
+
+#endif
@@ -0,0 +1,285 @@
+#ifndef EMBEDDED_FONT_H
+#define EMBEDDED_FONT_H
+
+// generated by bake_font from DejaVuSans.ttf at 24 px, do not edit
+
+#include "bitmap_font.h"
+
+constexpr BitmapGlyph embeddedGlyphs[] =
+{
+    {1, 1, 0, 22, 8, 0}, // ' '
+    {2, 18, 4, 5, 10, 1}, // '!'
+    {6, 7, 2, 5, 11, 19}, // '"'
+    {16, 18, 2, 5, 20, 26}, // '#'
+    {11, 22, 2, 5, 15, 62}, // '$'
+    {20, 18, 1, 5, 23, 106}, // '%'
+    {16, 18, 1, 5, 19, 160}, // '&'
+    {2, 7, 2, 5, 7, 196}, // '''
+    {5, 21, 2, 5, 9, 203}, // '('
+    {5, 21, 2, 5, 9, 224}, // ')'
+    {11, 10, 0, 5, 12, 245}, // '*'
+    {16, 16, 3, 7, 20, 265}, // '+'
+    {3, 6, 2, 20, 8, 297}, // ','
+    {6, 2, 1, 15, 9, 303}, // '-'
+    {2, 3, 3, 20, 8, 305}, // '.'
+    {8, 20, 0, 5, 8, 308}, // '/'
+    {12, 18, 2, 5, 15, 328}, // '0'
+    {10, 18, 3, 5, 15, 364}, // '1'
+    {11, 18, 2, 5, 15, 400}, // '2'
+    {12, 18, 2, 5, 15, 436}, // '3'
+    {13, 18, 1, 5, 15, 472}, // '4'
+    {11, 18, 2, 5, 15, 508}, // '5'
+    {12, 18, 2, 5, 15, 544}, // '6'
+    {11, 18, 2, 5, 15, 580}, // '7'
+    {12, 18, 2, 5, 15, 616}, // '8'
+    {12, 18, 2, 5, 15, 652}, // '9'
+    {2, 12, 3, 11, 8, 688}, // ':'
+    {3, 15, 2, 11, 8, 700}, // ';'
+    {15, 13, 3, 9, 20, 715}, // '<'
+    {15, 7, 3, 12, 20, 741}, // '='
+    {15, 13, 3, 9, 20, 755}, // '>'
+    {9, 18, 2, 5, 13, 781}, // '?'
+    {21, 21, 2, 6, 24, 817}, // '@'
+    {16, 18, 0, 5, 16, 880}, // 'A'
+    {12, 18, 2, 5, 16, 916}, // 'B'
+    {14, 18, 1, 5, 17, 952}, // 'C'
+    {15, 18, 2, 5, 18, 988}, // 'D'
+    {11, 18, 2, 5, 15, 1024}, // 'E'
+    {10, 18, 2, 5, 14, 1060}, // 'F'
+    {15, 18, 1, 5, 19, 1096}, // 'G'
+    {13, 18, 2, 5, 18, 1132}, // 'H'
+    {2, 18, 2, 5, 7, 1168}, // 'I'
+    {6, 23, -2, 5, 7, 1186}, // 'J'
+    {14, 18, 2, 5, 16, 1209}, // 'K'
+    {11, 18, 2, 5, 13, 1245}, // 'L'
+    {16, 18, 2, 5, 21, 1281}, // 'M'
+    {13, 18, 2, 5, 18, 1317}, // 'N'
+    {16, 18, 1, 5, 19, 1353}, // 'O'
+    {11, 18, 2, 5, 14, 1389}, // 'P'
+    {16, 21, 1, 5, 19, 1425}, // 'Q'
+    {13, 18, 2, 5, 17, 1467}, // 'R'
+    {12, 18, 2, 5, 15, 1503}, // 'S'
+    {14, 18, 0, 5, 15, 1539}, // 'T'
+    {13, 18, 2, 5, 18, 1575}, // 'U'
+    {16, 18, 0, 5, 16, 1611}, // 'V'
+    {22, 18, 1, 5, 24, 1647}, // 'W'
+    {15, 18, 1, 5, 17, 1701}, // 'X'
+    {14, 18, 0, 5, 15, 1737}, // 'Y'
+    {14, 18, 1, 5, 16, 1773}, // 'Z'
+    {5, 21, 2, 5, 9, 1809}, // '['
+    {8, 20, 0, 5, 8, 1830}, // '\'
+    {5, 21, 2, 5, 9, 1850}, // ']'
+    {15, 7, 3, 5, 20, 1871}, // '^'
+    {12, 2, 0, 27, 12, 1885}, // '_'
+    {6, 4, 2, 4, 12, 1889}, // '`'
+    {11, 13, 1, 10, 14, 1893}, // 'a'
+    {12, 18, 2, 5, 15, 1919}, // 'b'
+    {10, 13, 1, 10, 13, 1955}, // 'c'
+    {12, 18, 1, 5, 15, 1981}, // 'd'
+    {12, 13, 1, 10, 14, 2017}, // 'e'
+    {8, 18, 1, 5, 8, 2043}, // 'f'
+    {12, 18, 1, 10, 15, 2061}, // 'g'
+    {11, 18, 2, 5, 15, 2097}, // 'h'
+    {2, 18, 2, 5, 7, 2133}, // 'i'
+    {5, 23, -1, 5, 7, 2151}, // 'j'
+    {12, 18, 2, 5, 14, 2174}, // 'k'
+    {2, 18, 2, 5, 6, 2210}, // 'l'
+    {20, 13, 2, 10, 24, 2228}, // 'm'
+    {11, 13, 2, 10, 15, 2267}, // 'n'
+    {12, 13, 1, 10, 14, 2293}, // 'o'
+    {12, 18, 2, 10, 15, 2319}, // 'p'
+    {12, 18, 1, 10, 15, 2355}, // 'q'
+    {8, 13, 2, 10, 10, 2391}, // 'r'
+    {10, 13, 1, 10, 12, 2404}, // 's'
+    {8, 17, 0, 6, 9, 2430}, // 't'
+    {11, 13, 2, 10, 15, 2447}, // 'u'
+    {13, 13, 1, 10, 15, 2473}, // 'v'
+    {18, 13, 1, 10, 20, 2499}, // 'w'
+    {13, 13, 1, 10, 15, 2538}, // 'x'
+    {13, 18, 1, 10, 15, 2564}, // 'y'
+    {11, 13, 1, 10, 13, 2600}, // 'z'
+    {9, 22, 3, 5, 15, 2626}, // '{'
+    {2, 24, 3, 5, 8, 2670}, // '|'
+    {9, 22, 3, 5, 15, 2694}, // '}'
+    {15, 4, 3, 14, 20, 2738}, // '~'
+};
+
+constexpr unsigned char embeddedGlyphBits[] =
+{
+    0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00,
+    0xc0, 0xc0, 0xc0, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x03, 0x08, 0x03, 0x18, 0x03, 0x18,
+    0x03, 0x18, 0x02, 0x18, 0x7f, 0xff, 0x7f, 0xff, 0x06, 0x30, 0x04, 0x30, 0x0c, 0x20, 0x0c, 0x60,
+    0xff, 0xfe, 0xff, 0xfe, 0x18, 0x40, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x10, 0xc0, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x1f, 0x80, 0x7f, 0xc0, 0xe4, 0x40, 0xc4, 0x00, 0xc4, 0x00, 0xe4, 0x00,
+    0x7c, 0x00, 0x3f, 0x80, 0x07, 0xc0, 0x04, 0xe0, 0x04, 0x60, 0x04, 0x60, 0x84, 0xe0, 0xff, 0xc0,
+    0x3f, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x3c, 0x03, 0x00, 0x66, 0x07, 0x00,
+    0xc3, 0x06, 0x00, 0xc3, 0x0c, 0x00, 0xc3, 0x1c, 0x00, 0xc3, 0x18, 0x00, 0xc3, 0x38, 0x00, 0xc3,
+    0x30, 0x00, 0x66, 0x63, 0xc0, 0x3c, 0x66, 0x60, 0x00, 0xcc, 0x30, 0x01, 0xcc, 0x30, 0x01, 0x8c,
+    0x30, 0x03, 0x8c, 0x30, 0x03, 0x0c, 0x30, 0x06, 0x0c, 0x30, 0x0e, 0x06, 0x60, 0x0c, 0x03, 0xc0,
+    0x0f, 0xc0, 0x1f, 0xe0, 0x38, 0x20, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1c, 0x00,
+    0x3e, 0x00, 0x77, 0x06, 0xe3, 0x86, 0xc1, 0xcc, 0xc0, 0xec, 0xc0, 0x78, 0xe0, 0x38, 0x70, 0xfc,
+    0x3f, 0xce, 0x0f, 0x87, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x30, 0x30, 0x60, 0x60,
+    0x60, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18,
+    0xc0, 0x60, 0x60, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30,
+    0x30, 0x30, 0x60, 0x60, 0xc0, 0x04, 0x00, 0x04, 0x00, 0xc4, 0x60, 0x75, 0xc0, 0x1f, 0x00, 0x1f,
+    0x00, 0x75, 0xc0, 0xc4, 0x60, 0x04, 0x00, 0x04, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x60, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0xfc,
+    0xfc, 0xc0, 0xc0, 0xc0, 0x03, 0x07, 0x06, 0x06, 0x06, 0x0c, 0x0c, 0x0c, 0x1c, 0x18, 0x18, 0x38,
+    0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xe0, 0xc0, 0x0f, 0x00, 0x3f, 0xc0, 0x70, 0xe0, 0x60, 0x60,
+    0x60, 0x60, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30,
+    0xc0, 0x30, 0x60, 0x60, 0x60, 0x60, 0x70, 0xe0, 0x3f, 0xc0, 0x0f, 0x00, 0x3c, 0x00, 0xfc, 0x00,
+    0xcc, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0xff, 0xc0, 0xff, 0xc0,
+    0x3f, 0x00, 0xff, 0xc0, 0xc1, 0xc0, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xc0,
+    0x01, 0xc0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0xe0, 0x00,
+    0xff, 0xe0, 0xff, 0xe0, 0x3f, 0x00, 0x7f, 0xc0, 0x40, 0xc0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60,
+    0x00, 0x60, 0x00, 0xc0, 0x1f, 0x80, 0x1f, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x70, 0x80, 0xe0, 0xff, 0xc0, 0x3f, 0x80, 0x01, 0xc0, 0x03, 0xc0, 0x02, 0xc0, 0x06, 0xc0,
+    0x0c, 0xc0, 0x0c, 0xc0, 0x18, 0xc0, 0x38, 0xc0, 0x30, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0xc0, 0xc0,
+    0xff, 0xf8, 0xff, 0xf8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x7f, 0xc0, 0x7f, 0xc0,
+    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7f, 0x00, 0x7f, 0x80, 0x41, 0xc0, 0x00, 0xe0,
+    0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xe0, 0x81, 0xc0, 0xff, 0x80, 0x7e, 0x00,
+    0x07, 0xc0, 0x1f, 0xe0, 0x38, 0x20, 0x70, 0x00, 0x60, 0x00, 0xc0, 0x00, 0xcf, 0x80, 0xdf, 0xc0,
+    0xf8, 0xe0, 0xf0, 0x70, 0xe0, 0x30, 0xe0, 0x30, 0xe0, 0x30, 0x60, 0x30, 0x70, 0x70, 0x78, 0xe0,
+    0x3f, 0xc0, 0x0f, 0x80, 0xff, 0xe0, 0xff, 0xe0, 0x00, 0xc0, 0x00, 0xc0, 0x01, 0xc0, 0x01, 0x80,
+    0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x1c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x1f, 0x80, 0x7f, 0xe0, 0x70, 0xe0, 0xc0, 0x30,
+    0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0x70, 0xe0, 0x3f, 0xc0, 0x3f, 0xc0, 0x70, 0xe0, 0xc0, 0x30,
+    0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0x70, 0xe0, 0x7f, 0xe0, 0x1f, 0x80, 0x1f, 0x00, 0x3f, 0xc0,
+    0x71, 0xe0, 0xe0, 0xe0, 0xc0, 0x60, 0xc0, 0x70, 0xc0, 0x70, 0xc0, 0x70, 0xe0, 0xf0, 0x71, 0xf0,
+    0x3f, 0xb0, 0x1f, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0xe0, 0x41, 0xc0, 0x7f, 0x80, 0x3e, 0x00,
+    0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x60, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0x00, 0x02, 0x00, 0x1e, 0x00,
+    0xfc, 0x07, 0xe0, 0x1f, 0x80, 0xfc, 0x00, 0xe0, 0x00, 0xfc, 0x00, 0x1f, 0x80, 0x07, 0xe0, 0x00,
+    0xfc, 0x00, 0x1e, 0x00, 0x02, 0xff, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xfe, 0xff, 0xfe, 0x80, 0x00, 0xf0, 0x00, 0x7e, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x7e, 0x00,
+    0x0e, 0x00, 0x7e, 0x03, 0xf0, 0x0f, 0xc0, 0x7e, 0x00, 0xf0, 0x00, 0x80, 0x00, 0x3e, 0x00, 0x7f,
+    0x00, 0xc3, 0x80, 0x81, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x1c,
+    0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,
+    0x00, 0x00, 0xfc, 0x00, 0x07, 0xff, 0x00, 0x0f, 0x03, 0xc0, 0x1c, 0x00, 0xe0, 0x30, 0x00, 0x70,
+    0x70, 0xf3, 0x30, 0x63, 0xff, 0x38, 0xe3, 0x8f, 0x18, 0xc6, 0x07, 0x18, 0xc6, 0x03, 0x18, 0xc6,
+    0x03, 0x18, 0xc6, 0x03, 0x18, 0xc6, 0x07, 0x30, 0xe3, 0x8f, 0x70, 0x63, 0xff, 0xe0, 0x70, 0xf3,
+    0x80, 0x38, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x0f, 0x03, 0x80, 0x07, 0xff, 0x00, 0x01, 0xfc, 0x00,
+    0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0xe0, 0x06, 0x60, 0x06, 0x60, 0x0c, 0x30, 0x0c, 0x30,
+    0x0c, 0x30, 0x18, 0x18, 0x18, 0x18, 0x38, 0x1c, 0x3f, 0xfc, 0x3f, 0xfc, 0x60, 0x06, 0x60, 0x06,
+    0x60, 0x06, 0xc0, 0x03, 0xff, 0x00, 0xff, 0xc0, 0xc0, 0xe0, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60,
+    0xc0, 0x60, 0xc0, 0xc0, 0xff, 0x80, 0xff, 0xc0, 0xc0, 0x60, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30,
+    0xc0, 0x30, 0xc0, 0x60, 0xff, 0xe0, 0xff, 0x80, 0x07, 0xe0, 0x1f, 0xf8, 0x3c, 0x1c, 0x70, 0x04,
+    0x60, 0x00, 0xe0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0xe0, 0x00, 0x60, 0x00, 0x70, 0x04, 0x3c, 0x1c, 0x1f, 0xf8, 0x07, 0xe0, 0xff, 0x80, 0xff, 0xf0,
+    0xc0, 0x78, 0xc0, 0x1c, 0xc0, 0x0c, 0xc0, 0x0e, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x06,
+    0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x0e, 0xc0, 0x0c, 0xc0, 0x1c, 0xc0, 0x78, 0xff, 0xf0, 0xff, 0x80,
+    0xff, 0xe0, 0xff, 0xe0, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0xff, 0xc0, 0xff, 0xc0, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0xff, 0xe0, 0xff, 0xe0, 0xff, 0xc0, 0xff, 0xc0, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x07, 0xe0, 0x1f, 0xf8, 0x38, 0x1c, 0x70, 0x04,
+    0x60, 0x00, 0xe0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x7e, 0xc0, 0x7e, 0xc0, 0x06, 0xc0, 0x06,
+    0xe0, 0x06, 0x60, 0x06, 0x70, 0x06, 0x3c, 0x0e, 0x1f, 0xfc, 0x07, 0xf0, 0xc0, 0x18, 0xc0, 0x18,
+    0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xff, 0xf8, 0xff, 0xf8,
+    0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x18, 0xf8, 0xf0, 0xc0, 0x70, 0xc0, 0xe0, 0xc1, 0xc0, 0xc3,
+    0x80, 0xc7, 0x00, 0xce, 0x00, 0xdc, 0x00, 0xf8, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xce, 0x00, 0xc7,
+    0x00, 0xc3, 0x80, 0xc1, 0xc0, 0xc0, 0xe0, 0xc0, 0x70, 0xc0, 0x38, 0xc0, 0x1c, 0xc0, 0x00, 0xc0,
+    0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+    0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0xe0, 0xff,
+    0xe0, 0xe0, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xf8, 0x1f, 0xd8, 0x1b, 0xd8, 0x1b, 0xcc, 0x33, 0xcc,
+    0x33, 0xcc, 0x33, 0xc6, 0x63, 0xc6, 0x63, 0xc7, 0xe3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0x83, 0xc0,
+    0x03, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x18, 0xf0, 0x18, 0xf0, 0x18, 0xf8, 0x18, 0xd8, 0x18, 0xcc,
+    0x18, 0xcc, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc1, 0x98, 0xc1, 0x98, 0xc0,
+    0xd8, 0xc0, 0xd8, 0xc0, 0x78, 0xc0, 0x78, 0xc0, 0x38, 0x07, 0xe0, 0x1f, 0xf8, 0x3c, 0x1c, 0x70,
+    0x0e, 0x60, 0x06, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+    0x03, 0xe0, 0x07, 0x60, 0x06, 0x70, 0x0e, 0x38, 0x1c, 0x1f, 0xf8, 0x07, 0xe0, 0xff, 0x00, 0xff,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0xc0, 0xff, 0xc0, 0xff,
+    0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+    0x00, 0x07, 0xe0, 0x1f, 0xf8, 0x3c, 0x1c, 0x70, 0x0e, 0x60, 0x06, 0xe0, 0x07, 0xc0, 0x03, 0xc0,
+    0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0x60, 0x06, 0x70, 0x0e, 0x38,
+    0x1c, 0x1f, 0xf8, 0x07, 0xf0, 0x00, 0x38, 0x00, 0x18, 0x00, 0x0c, 0xff, 0x00, 0xff, 0xc0, 0xc0,
+    0xe0, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0xc0, 0xff, 0xc0, 0xff, 0x80, 0xc1,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x70, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x18, 0x1f,
+    0xc0, 0x7f, 0xe0, 0x70, 0x60, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x70, 0x00, 0x7f,
+    0x00, 0x1f, 0xc0, 0x01, 0xe0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xc0, 0xe0, 0xff,
+    0xe0, 0x3f, 0x80, 0xff, 0xfc, 0xff, 0xfc, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0,
+    0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0,
+    0x18, 0xc0, 0x18, 0x60, 0x30, 0x70, 0x70, 0x3f, 0xe0, 0x1f, 0xc0, 0xc0, 0x03, 0x60, 0x06, 0x60,
+    0x06, 0x60, 0x06, 0x30, 0x0c, 0x30, 0x0c, 0x38, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x0c, 0x30, 0x0c,
+    0x30, 0x0c, 0x30, 0x06, 0x60, 0x06, 0x60, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xc0,
+    0x78, 0x0c, 0xc0, 0x78, 0x0c, 0x60, 0x78, 0x18, 0x60, 0x78, 0x18, 0x60, 0xec, 0x18, 0x60, 0xcc,
+    0x18, 0x30, 0xcc, 0x30, 0x30, 0xcc, 0x30, 0x31, 0xce, 0x30, 0x31, 0x86, 0x30, 0x19, 0x86, 0x60,
+    0x19, 0x86, 0x60, 0x19, 0x86, 0x60, 0x1b, 0x03, 0x60, 0x0f, 0x03, 0xc0, 0x0f, 0x03, 0xc0, 0x0f,
+    0x03, 0xc0, 0x0e, 0x01, 0xc0, 0x70, 0x0e, 0x30, 0x0c, 0x18, 0x18, 0x1c, 0x38, 0x0c, 0x70, 0x06,
+    0x60, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x03, 0xc0, 0x07, 0xc0, 0x06, 0xe0, 0x0c, 0x60, 0x1c,
+    0x30, 0x38, 0x38, 0x30, 0x18, 0x60, 0x0c, 0xe0, 0x0e, 0xe0, 0x1c, 0x60, 0x18, 0x30, 0x30, 0x38,
+    0x70, 0x18, 0x60, 0x1c, 0xe0, 0x0f, 0xc0, 0x07, 0x80, 0x07, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xff, 0xfc, 0xff,
+    0xfc, 0x00, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60, 0x00, 0xc0, 0x01, 0x80, 0x03, 0x80, 0x07,
+    0x00, 0x06, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60, 0x00, 0xff, 0xfc, 0xff,
+    0xfc, 0xf8, 0xf8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xf8, 0xf8, 0xc0, 0xe0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x18, 0x18,
+    0x18, 0x18, 0x0c, 0x0c, 0x0c, 0x06, 0x06, 0x06, 0x07, 0x03, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x03,
+    0x80, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70, 0x38, 0x38, 0x70, 0x1c, 0xe0, 0x0e, 0xff, 0xf0, 0xff,
+    0xf0, 0xe0, 0x30, 0x18, 0x0c, 0x3f, 0x00, 0x7f, 0xc0, 0x40, 0xc0, 0x00, 0x60, 0x00, 0x60, 0x1f,
+    0xe0, 0x7f, 0xe0, 0xe0, 0x60, 0xc0, 0x60, 0xc0, 0xe0, 0xe1, 0xe0, 0x7f, 0xe0, 0x3e, 0x60, 0xc0,
+    0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xcf, 0x80, 0xff, 0xc0, 0xf0, 0xe0, 0xe0,
+    0x60, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xe0, 0x60, 0xf0, 0xe0, 0xff,
+    0xc0, 0xcf, 0x80, 0x0f, 0x80, 0x3f, 0xc0, 0x70, 0x40, 0x60, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+    0x00, 0xc0, 0x00, 0xc0, 0x00, 0x60, 0x00, 0x70, 0x40, 0x3f, 0xc0, 0x1f, 0x80, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x1f, 0x30, 0x3f, 0xf0, 0x70, 0xf0, 0x60, 0x70, 0xc0,
+    0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0x60, 0x70, 0x70, 0xf0, 0x3f, 0xf0, 0x1f,
+    0x30, 0x0f, 0x80, 0x3f, 0xc0, 0x70, 0xe0, 0x60, 0x30, 0xc0, 0x30, 0xff, 0xf0, 0xff, 0xf0, 0xc0,
+    0x00, 0xc0, 0x00, 0x60, 0x00, 0x70, 0x20, 0x3f, 0xe0, 0x0f, 0xc0, 0x0f, 0x1f, 0x30, 0x30, 0x30,
+    0xff, 0xff, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1f, 0x30, 0x3f,
+    0xf0, 0x70, 0xf0, 0xe0, 0x70, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xe0,
+    0x70, 0x70, 0xf0, 0x3f, 0xf0, 0x1f, 0x30, 0x00, 0x30, 0x00, 0x70, 0x20, 0xe0, 0x3f, 0xc0, 0x1f,
+    0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xcf, 0x80, 0xff, 0xc0, 0xf0,
+    0xe0, 0xe0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0,
+    0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf0, 0xe0, 0xc0, 0x00,
+    0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc1, 0xc0, 0xc3, 0x80, 0xc7, 0x00, 0xce, 0x00,
+    0xdc, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xdc, 0x00, 0xce, 0x00, 0xc7, 0x00, 0xc3, 0x80, 0xc1, 0xc0,
+    0xc0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xcf, 0x87, 0xc0, 0xff, 0xdf, 0xe0, 0xf0, 0xf8, 0x70, 0xe0, 0x70, 0x30,
+    0xc0, 0x60, 0x30, 0xc0, 0x60, 0x30, 0xc0, 0x60, 0x30, 0xc0, 0x60, 0x30, 0xc0, 0x60, 0x30, 0xc0,
+    0x60, 0x30, 0xc0, 0x60, 0x30, 0xc0, 0x60, 0x30, 0xc0, 0x60, 0x30, 0xcf, 0x80, 0xff, 0xc0, 0xf0,
+    0xe0, 0xe0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0,
+    0x60, 0xc0, 0x60, 0xc0, 0x60, 0x1f, 0x80, 0x3f, 0xc0, 0x70, 0xe0, 0xe0, 0x60, 0xc0, 0x30, 0xc0,
+    0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xe0, 0x60, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xcf,
+    0x80, 0xff, 0xc0, 0xf0, 0xe0, 0xe0, 0x60, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0,
+    0x30, 0xe0, 0x60, 0xf0, 0xe0, 0xff, 0xc0, 0xcf, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+    0x00, 0xc0, 0x00, 0x1f, 0x30, 0x3f, 0xf0, 0x70, 0xf0, 0x60, 0x70, 0xc0, 0x30, 0xc0, 0x30, 0xc0,
+    0x30, 0xc0, 0x30, 0xc0, 0x30, 0x60, 0x70, 0x70, 0xf0, 0x3f, 0xf0, 0x1f, 0x30, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xcf, 0xff, 0xf0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x3f, 0x00, 0x7f, 0x80, 0xe0, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xfc, 0x00,
+    0x3f, 0x80, 0x07, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x81, 0xc0, 0xff, 0x80, 0x7f, 0x00, 0x30, 0x30,
+    0x30, 0x30, 0xff, 0xff, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x1f, 0xc0,
+    0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0,
+    0x60, 0xc0, 0xe0, 0xe1, 0xe0, 0x7f, 0xe0, 0x3e, 0x60, 0xc0, 0x18, 0x60, 0x30, 0x60, 0x30, 0x60,
+    0x70, 0x30, 0x60, 0x30, 0x60, 0x18, 0xe0, 0x18, 0xc0, 0x18, 0xc0, 0x0d, 0x80, 0x0d, 0x80, 0x0f,
+    0x80, 0x07, 0x00, 0xc1, 0xe0, 0xc0, 0xc1, 0xe0, 0xc0, 0x61, 0xe1, 0x80, 0x61, 0xe1, 0x80, 0x63,
+    0x31, 0x80, 0x73, 0x33, 0x80, 0x33, 0x33, 0x00, 0x33, 0x33, 0x00, 0x36, 0x1b, 0x00, 0x1e, 0x1e,
+    0x00, 0x1e, 0x1e, 0x00, 0x1e, 0x1e, 0x00, 0x1c, 0x0e, 0x00, 0xe0, 0x38, 0x70, 0x70, 0x38, 0xe0,
+    0x18, 0xc0, 0x0d, 0x80, 0x0f, 0x80, 0x07, 0x00, 0x0f, 0x80, 0x1d, 0xc0, 0x18, 0xc0, 0x30, 0x60,
+    0x70, 0x70, 0xe0, 0x38, 0xc0, 0x18, 0x60, 0x30, 0x60, 0x30, 0x70, 0x70, 0x30, 0x60, 0x30, 0xe0,
+    0x18, 0xc0, 0x18, 0xc0, 0x0d, 0x80, 0x0d, 0x80, 0x0f, 0x80, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0x0c, 0x00, 0x7c, 0x00, 0x78, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0x00, 0xc0, 0x01, 0xc0,
+    0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60, 0x00, 0xff, 0xe0,
+    0xff, 0xe0, 0x07, 0x80, 0x0f, 0x80, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+    0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0f, 0x80, 0x07, 0x80, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0x00, 0xf8, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
+    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x0f, 0x80, 0x0f, 0x80, 0x1c, 0x00,
+    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xf8, 0x00,
+    0xf0, 0x00, 0x3e, 0x02, 0x7f, 0x86, 0xc3, 0xfc, 0x00, 0xf8,
+};
+
+constexpr BitmapFont embeddedFont = {embeddedGlyphs, embeddedGlyphBits, 29};
+
+#endif
@@ -0,0 +1,132 @@
+#include "frame_bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+void initFrameBench(FrameBench* bench, int argc, char* argv[])
+{
+    bench->frames = 0;
+
+    bench->path = NULL;
+
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], "--bench") == 0)
+        {
+            bench->frames = atoi(argv[i + 1]);
+        }
+        else if (strcmp(argv[i], "--bench-json") == 0)
+        {
+            bench->path = argv[i + 1];
+        }
+    }
+
+    bench->frameMs.clear();
+
+    bench->frameMs.reserve(bench->frames > 0 ? bench->frames : 0);
+
+    bench->drawCalls = 0;
+
+    bench->frameStart = 0;
+
+    bench->cpuStart = 0;
+}
+
+bool benchFrame(FrameBench* bench, int drawCalls)
+{
+    if (!benchmarking(bench))
+    {
+        return true;
+    }
+
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    // a frame is timed from one present to the next, so the first only starts
+    // the clock; it also carries the start up work, which is not what is measured
+
+    if (bench->frameStart == 0)
+    {
+        bench->frameStart = now;
+
+        bench->cpuStart = clock();
+
+        return true;
+    }
+
+    bench->frameMs.push_back((double)(now - bench->frameStart) * 1000.0 / (double)SDL_GetPerformanceFrequency());
+
+    bench->frameStart = now;
+
+    bench->drawCalls += drawCalls;
+
+    return (int)bench->frameMs.size() < bench->frames;
+}
+
+// the value below which the given fraction of frames fall
+static double percentile(std::vector<double>* sorted, double fraction)
+{
+    size_t index = (size_t)(fraction * (double)(sorted->size() - 1) + 0.5);
+
+    return (*sorted)[index];
+}
+
+// "bench/results/Task_101.json" -> "Task_101"
+static void sceneName(const char* path, char* name, size_t size)
+{
+    const char* start = path != NULL ? path : "scene";
+
+    const char* slash = strrchr(start, '/');
+
+    if (slash != NULL)
+    {
+        start = slash + 1;
+    }
+
+    size_t length = strcspn(start, ".");
+
+    length = length < size - 1 ? length : size - 1;
+
+    memcpy(name, start, length);
+
+    name[length] = '\0';
+}
+
+void writeFrameBench(const FrameBench* bench)
+{
+    double cpuMs = (double)(clock() - bench->cpuStart) * 1000.0 / CLOCKS_PER_SEC;
+
+    int frames = (int)bench->frameMs.size();
+
+    std::vector<double> sorted = bench->frameMs;
+
+    std::sort(sorted.begin(), sorted.end());
+
+    char name[64];
+
+    sceneName(bench->path, name, sizeof(name));
+
+    FILE* file = bench->path != NULL ? fopen(bench->path, "w") : stdout;
+
+    if (file == NULL)
+    {
+        printf("Could not write %s\n", bench->path);
+
+        return;
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "    \"scene\": \"%s\",\n", name);
+    fprintf(file, "    \"frames\": %d,\n", frames);
+    fprintf(file, "    \"p50_ms\": %.4f,\n", frames > 0 ? percentile(&sorted, 0.50) : 0.0);
+    fprintf(file, "    \"p99_ms\": %.4f,\n", frames > 0 ? percentile(&sorted, 0.99) : 0.0);
+    fprintf(file, "    \"max_ms\": %.4f,\n", frames > 0 ? sorted.back() : 0.0);
+    fprintf(file, "    \"draw_calls\": %.2f,\n", frames > 0 ? (double)bench->drawCalls / frames : 0.0);
+    fprintf(file, "    \"cpu_ms\": %.4f\n", frames > 0 ? cpuMs / frames : 0.0);
+    fprintf(file, "}\n");
+
+    if (file != stdout)
+    {
+        fclose(file);
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef FRAME_BENCH_H
+#define FRAME_BENCH_H
+
+#include <SDL2/SDL.h>
+#include <time.h>
+#include <vector>
+
+// --bench N runs a program for N frames after one warm up frame and then
+// stops, writing the frame time percentiles, draw calls and CPU time per
+// frame as JSON to the file given with --bench-json (stdout without it). the
+// scene is named after that file. make bench runs every program this way and
+// checks the results with bench_compare
+
+typedef struct FrameBench
+{
+    int frames; // to run, 0 when not benchmarking
+    const char* path; // where the JSON goes, NULL for stdout
+    std::vector<double> frameMs;
+    long drawCalls;
+    Uint64 frameStart; // previous present, 0 before the first
+    clock_t cpuStart;
+} FrameBench;
+
+void initFrameBench(FrameBench* bench, int argc, char* argv[]);
+
+inline bool benchmarking(const FrameBench* bench)
+{
+    return bench->frames > 0;
+}
+
+// call once per frame after the present with the frame's draw calls, as the
+// program counts them; returns false once the last frame has been measured
+bool benchFrame(FrameBench* bench, int drawCalls);
+
+// writes the report, also for a run that ended before all frames were done
+void writeFrameBench(const FrameBench* bench);
+
+#endif
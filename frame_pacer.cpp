@@ -0,0 +1,127 @@
+#include "frame_pacer.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int targetFpsFromArguments(int argc, char* argv[])
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], "--fps") == 0)
+        {
+            int fps = atoi(argv[i + 1]);
+
+            return fps > 0 ? fps : 0;
+        }
+    }
+
+    return DEFAULT_TARGET_FPS;
+}
+
+static void resetPacerStats(FramePacer* pacer)
+{
+    pacer->frames = 0;
+
+    pacer->sumMs = 0.0;
+
+    pacer->sumSquaresMs = 0.0;
+
+    pacer->worstMs = 0.0;
+}
+
+void initFramePacer(FramePacer* pacer, SDL_Renderer* renderer, int targetFps)
+{
+    SDL_RendererInfo info;
+
+    bool vsync = SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_PRESENTVSYNC) != 0;
+
+    pacer->frequency = SDL_GetPerformanceFrequency();
+
+    pacer->targetFps = vsync ? 0 : targetFps;
+
+    pacer->frameLength = pacer->targetFps > 0 ? pacer->frequency / pacer->targetFps : 0;
+
+    pacer->deadline = SDL_GetPerformanceCounter() + pacer->frameLength;
+
+    pacer->lastRelease = 0;
+
+    pacer->reportFrames = PACER_REPORT_SECONDS * (targetFps > 0 ? targetFps : DEFAULT_TARGET_FPS);
+
+    resetPacerStats(pacer);
+}
+
+void waitForNextFrame(FramePacer* pacer)
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    if (pacer->frameLength > 0)
+    {
+        Uint64 spinTicks = pacer->frequency * PACER_SPIN_MS / 1000;
+
+        if (now + spinTicks < pacer->deadline)
+        {
+            SDL_Delay((Uint32)((pacer->deadline - now - spinTicks) * 1000 / pacer->frequency));
+        }
+
+        while ((now = SDL_GetPerformanceCounter()) < pacer->deadline)
+        {
+            // spin
+        }
+
+        pacer->deadline += pacer->frameLength;
+
+        // a frame that ran long starts a new schedule instead of rushing to catch up
+
+        if (pacer->deadline < now)
+        {
+            pacer->deadline = now + pacer->frameLength;
+        }
+    }
+
+    if (pacer->lastRelease != 0)
+    {
+        double intervalMs = (double)(now - pacer->lastRelease) * 1000.0 / (double)pacer->frequency;
+
+        pacer->sumMs += intervalMs;
+
+        pacer->sumSquaresMs += intervalMs * intervalMs;
+
+        if (intervalMs > pacer->worstMs)
+        {
+            pacer->worstMs = intervalMs;
+        }
+
+        pacer->frames++;
+    }
+
+    pacer->lastRelease = now;
+
+    if (pacer->frames == pacer->reportFrames)
+    {
+        double meanMs = pacer->sumMs / pacer->frames;
+
+        double jitterMs = sqrt(fmax(0.0, pacer->sumSquaresMs / pacer->frames - meanMs * meanMs));
+
+        if (pacer->targetFps > 0)
+        {
+            printf("pacer: target %.3f ms, frame %.3f ms, jitter %.3f ms, worst %.3f ms\n",
+                   1000.0 / pacer->targetFps, meanMs, jitterMs, pacer->worstMs);
+        }
+        else
+        {
+            printf("pacer: unpaced, frame %.3f ms, jitter %.3f ms, worst %.3f ms\n", meanMs, jitterMs, pacer->worstMs);
+        }
+
+        resetPacerStats(pacer);
+    }
+}
+
+void waitWhileIdle(FramePacer* pacer, int timeoutMs)
+{
+    SDL_WaitEventTimeout(NULL, timeoutMs);
+
+    pacer->deadline = SDL_GetPerformanceCounter();
+
+    pacer->lastRelease = 0;
+}
@@ -0,0 +1,36 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <SDL2/SDL.h>
+
+#define DEFAULT_TARGET_FPS 60
+#define PACER_SPIN_MS 2 // the last stretch before a deadline is busy-waited, SDL_Delay is too coarse for it
+#define PACER_REPORT_SECONDS 5
+
+typedef struct FramePacer
+{
+    Uint64 frequency;
+    Uint64 frameLength; // performance counter ticks per frame, 0 when not pacing
+    Uint64 deadline;
+    Uint64 lastRelease; // 0 right after an idle wait, so the gap is not counted
+    int targetFps;
+    int reportFrames;
+    int frames;
+    double sumMs, sumSquaresMs, worstMs; // frame intervals since the last report
+} FramePacer;
+
+// --fps N, DEFAULT_TARGET_FPS when absent, 0 turns pacing off
+int targetFpsFromArguments(int argc, char* argv[]);
+
+// pacing is skipped when the renderer already waits for vsync, the intervals are still reported
+void initFramePacer(FramePacer* pacer, SDL_Renderer* renderer, int targetFps);
+
+// call right before presenting: sleeps most of the time left in the frame and
+// spins the rest, then records the interval and prints the jitter every few seconds
+void waitForNextFrame(FramePacer* pacer);
+
+// for when nothing on screen is changing: blocks in SDL_WaitEventTimeout until an
+// event arrives (left in the queue) or the timeout runs out
+void waitWhileIdle(FramePacer* pacer, int timeoutMs);
+
+#endif
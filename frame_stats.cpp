@@ -0,0 +1,60 @@
+#include "frame_stats.h"
+#include <stdio.h>
+
+void initFrameStats(FrameStats* stats, const char* label)
+{
+    stats->label = label;
+
+    stats->frameStart = 0;
+
+    stats->totalMs = 0.0;
+
+    stats->renderCalls = 0;
+
+    stats->pixels = 0;
+
+    stats->frames = 0;
+}
+
+void beginFrame(FrameStats* stats)
+{
+    stats->frameStart = SDL_GetPerformanceCounter();
+}
+
+void countPixels(FrameStats* stats, long pixels)
+{
+    stats->pixels += pixels;
+}
+
+void endFrame(FrameStats* stats, int renderCalls)
+{
+    Uint64 elapsed = SDL_GetPerformanceCounter() - stats->frameStart;
+
+    stats->totalMs += (double)elapsed * 1000.0 / (double)SDL_GetPerformanceFrequency();
+
+    stats->renderCalls += renderCalls;
+
+    stats->frames++;
+
+    if (stats->frames == FRAME_STATS_INTERVAL)
+    {
+        if (stats->pixels > 0)
+        {
+            printf("%s: %.3f ms/frame, %ld render calls/frame, %ld pixels/frame\n", stats->label,
+                   stats->totalMs / stats->frames, stats->renderCalls / stats->frames, stats->pixels / stats->frames);
+        }
+        else
+        {
+            printf("%s: %.3f ms/frame, %ld render calls/frame\n", stats->label,
+                   stats->totalMs / stats->frames, stats->renderCalls / stats->frames);
+        }
+
+        stats->totalMs = 0.0;
+
+        stats->renderCalls = 0;
+
+        stats->pixels = 0;
+
+        stats->frames = 0;
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <SDL2/SDL.h>
+
+#define FRAME_STATS_INTERVAL 120
+
+typedef struct FrameStats
+{
+    const char* label;
+    Uint64 frameStart;
+    double totalMs;
+    long renderCalls;
+    long pixels; // touched by drawing, for programs that count them
+    int frames;
+} FrameStats;
+
+void initFrameStats(FrameStats* stats, const char* label);
+
+void beginFrame(FrameStats* stats);
+
+void countPixels(FrameStats* stats, long pixels);
+
+// prints the average draw time and render calls (and pixels, if counted) every FRAME_STATS_INTERVAL frames
+void endFrame(FrameStats* stats, int renderCalls);
+
+#endif
@@ -0,0 +1,292 @@
+#include "glyph_atlas.h"
+#include <stdio.h>
+
+#define GLYPH_PADDING 1 // empty texels between glyphs so filtering never picks up a neighbour
+
+static const Glyph* findGlyph(const GlyphAtlas* atlas, char character)
+{
+    unsigned char code = (unsigned char)character;
+
+    if (code < GLYPH_FIRST || code > GLYPH_LAST)
+    {
+        return NULL;
+    }
+
+    return &atlas->glyphs[code - GLYPH_FIRST];
+}
+
+// places the glyph surfaces on rows of the atlas, left to right, copies them
+// into one texture and frees them; glyphs without a surface take no space
+static bool packGlyphs(GlyphAtlas* atlas, SDL_Renderer* renderer, SDL_Surface** surfaces)
+{
+    const int count = GLYPH_LAST - GLYPH_FIRST + 1;
+
+    int x = GLYPH_PADDING, y = GLYPH_PADDING, rowHeight = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        atlas->glyphs[i].source = {0, 0, 0, 0};
+
+        if (surfaces[i] == NULL)
+        {
+            continue;
+        }
+
+        if (x + surfaces[i]->w + GLYPH_PADDING > GLYPH_ATLAS_WIDTH)
+        {
+            x = GLYPH_PADDING;
+
+            y += rowHeight + GLYPH_PADDING;
+
+            rowHeight = 0;
+        }
+
+        atlas->glyphs[i].source = {x, y, surfaces[i]->w, surfaces[i]->h};
+
+        x += surfaces[i]->w + GLYPH_PADDING;
+
+        rowHeight = SDL_max(rowHeight, surfaces[i]->h);
+    }
+
+    atlas->width = GLYPH_ATLAS_WIDTH;
+
+    atlas->height = y + rowHeight + GLYPH_PADDING;
+
+    // copy them into one surface, alpha included, and upload it
+
+    SDL_Surface* pixels = SDL_CreateRGBSurfaceWithFormat(0, atlas->width, atlas->height, 32, SDL_PIXELFORMAT_ARGB8888);
+
+    if (pixels != NULL)
+    {
+        SDL_FillRect(pixels, NULL, 0x00ffffffu);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (surfaces[i] == NULL)
+        {
+            continue;
+        }
+
+        if (pixels != NULL)
+        {
+            SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+
+            SDL_BlitSurface(surfaces[i], NULL, pixels, &atlas->glyphs[i].source);
+        }
+
+        SDL_FreeSurface(surfaces[i]);
+    }
+
+    if (pixels == NULL)
+    {
+        printf("Glyph atlas creation failed: %s\n", SDL_GetError());
+
+        return false;
+    }
+
+    atlas->texture = SDL_CreateTextureFromSurface(renderer, pixels);
+
+    SDL_FreeSurface(pixels);
+
+    if (atlas->texture == NULL)
+    {
+        printf("Glyph atlas texture creation failed: %s\n", SDL_GetError());
+
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(atlas->texture, SDL_BLENDMODE_BLEND);
+
+    // the index pattern is the same for every string, only its length changes
+
+    atlas->vertices.resize(4 * GLYPH_TEXT_MAX);
+
+    atlas->indices.resize(6 * GLYPH_TEXT_MAX);
+
+    for (int i = 0; i < GLYPH_TEXT_MAX; i++)
+    {
+        int* quad = &atlas->indices[6 * i];
+
+        quad[0] = 4 * i;
+        quad[1] = 4 * i + 1;
+        quad[2] = 4 * i + 2;
+        quad[3] = 4 * i + 2;
+        quad[4] = 4 * i + 1;
+        quad[5] = 4 * i + 3;
+    }
+
+    return true;
+}
+
+bool createGlyphAtlas(GlyphAtlas* atlas, SDL_Renderer* renderer, TTF_Font* font)
+{
+    SDL_Surface* surfaces[GLYPH_LAST - GLYPH_FIRST + 1];
+
+    for (int i = 0; i <= GLYPH_LAST - GLYPH_FIRST; i++)
+    {
+        Uint16 code = (Uint16)(GLYPH_FIRST + i);
+
+        int advance = 0;
+
+        TTF_GlyphMetrics(font, code, NULL, NULL, NULL, NULL, &advance);
+
+        // SDL_ttf renders a glyph as a whole line high box starting at the pen
+
+        atlas->glyphs[i].left = 0;
+
+        atlas->glyphs[i].top = 0;
+
+        atlas->glyphs[i].advance = advance;
+
+        surfaces[i] = code == ' ' ? NULL : TTF_RenderGlyph_Blended(font, code, (SDL_Color){255, 255, 255, 255});
+    }
+
+    atlas->lineHeight = TTF_FontHeight(font);
+
+    return packGlyphs(atlas, renderer, surfaces);
+}
+
+bool createBitmapGlyphAtlas(GlyphAtlas* atlas, SDL_Renderer* renderer, const BitmapFont* font)
+{
+    SDL_Surface* surfaces[GLYPH_LAST - GLYPH_FIRST + 1];
+
+    for (int i = 0; i <= GLYPH_LAST - GLYPH_FIRST; i++)
+    {
+        const BitmapGlyph* glyph = &font->glyphs[i];
+
+        atlas->glyphs[i].left = glyph->left;
+
+        atlas->glyphs[i].top = glyph->top;
+
+        atlas->glyphs[i].advance = glyph->advance;
+
+        surfaces[i] = NULL;
+
+        if (glyph->width == 0 || GLYPH_FIRST + i == ' ')
+        {
+            continue;
+        }
+
+        surfaces[i] = SDL_CreateRGBSurfaceWithFormat(0, glyph->width, glyph->rows, 32, SDL_PIXELFORMAT_ARGB8888);
+
+        if (surfaces[i] == NULL)
+        {
+            continue;
+        }
+
+        const unsigned char* bits = font->bits + glyph->offset;
+
+        int rowBytes = (glyph->width + 7) / 8;
+
+        for (int y = 0; y < glyph->rows; y++)
+        {
+            Uint32* row = (Uint32*)((Uint8*)surfaces[i]->pixels + y * surfaces[i]->pitch);
+
+            for (int x = 0; x < glyph->width; x++)
+            {
+                bool set = (bits[y * rowBytes + x / 8] & (0x80 >> (x % 8))) != 0;
+
+                row[x] = set ? 0xffffffffu : 0x00ffffffu;
+            }
+        }
+    }
+
+    atlas->lineHeight = font->lineHeight;
+
+    return packGlyphs(atlas, renderer, surfaces);
+}
+
+void destroyGlyphAtlas(GlyphAtlas* atlas)
+{
+    SDL_DestroyTexture(atlas->texture);
+
+    atlas->texture = NULL;
+}
+
+int textWidth(const GlyphAtlas* atlas, const char* text)
+{
+    int width = 0;
+
+    for (int i = 0; text[i] != '\0' && i < GLYPH_TEXT_MAX; i++)
+    {
+        const Glyph* glyph = findGlyph(atlas, text[i]);
+
+        if (glyph != NULL)
+        {
+            width += glyph->advance;
+        }
+    }
+
+    return width;
+}
+
+void drawText(SDL_Renderer* renderer, GlyphAtlas* atlas, const char* text, int x, int y, SDL_Color color)
+{
+    float scaleU = 1.0f / atlas->width;
+
+    float scaleV = 1.0f / atlas->height;
+
+    int quads = 0;
+
+    for (int i = 0; text[i] != '\0' && i < GLYPH_TEXT_MAX; i++)
+    {
+        const Glyph* glyph = findGlyph(atlas, text[i]);
+
+        if (glyph == NULL)
+        {
+            continue;
+        }
+
+        if (glyph->source.w > 0)
+        {
+            const SDL_Rect* source = &glyph->source;
+
+            float left = (float)(x + glyph->left), top = (float)(y + glyph->top);
+
+            float right = left + source->w, bottom = top + source->h;
+
+            float u0 = source->x * scaleU, v0 = source->y * scaleV;
+
+            float u1 = (source->x + source->w) * scaleU, v1 = (source->y + source->h) * scaleV;
+
+            SDL_Vertex* quad = &atlas->vertices[4 * quads];
+
+            quad[0] = {{left, top}, color, {u0, v0}};
+            quad[1] = {{right, top}, color, {u1, v0}};
+            quad[2] = {{left, bottom}, color, {u0, v1}};
+            quad[3] = {{right, bottom}, color, {u1, v1}};
+
+            quads++;
+        }
+
+        x += glyph->advance;
+    }
+
+    if (quads > 0)
+    {
+        SDL_RenderGeometry(renderer, atlas->texture, atlas->vertices.data(), 4 * quads, atlas->indices.data(), 6 * quads);
+    }
+}
+
+void batchText(RenderBatch* batch, const GlyphAtlas* atlas, const char* text, int x, int y)
+{
+    for (int i = 0; text[i] != '\0' && i < GLYPH_TEXT_MAX; i++)
+    {
+        const Glyph* glyph = findGlyph(atlas, text[i]);
+
+        if (glyph == NULL)
+        {
+            continue;
+        }
+
+        if (glyph->source.w > 0)
+        {
+            SDL_Rect destination = {x + glyph->left, y + glyph->top, glyph->source.w, glyph->source.h};
+
+            batchTexture(batch, atlas->texture, &glyph->source, &destination);
+        }
+
+        x += glyph->advance;
+    }
+}
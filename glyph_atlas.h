@@ -0,0 +1,53 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <vector>
+#include "bitmap_font.h"
+#include "render_batch.h"
+
+// every printable ASCII glyph of a font, from a TTF file or compiled in,
+// rendered once, white on transparent, into one texture. a string is then
+// drawn as one SDL_RenderGeometry call of textured quads tinted by the vertex
+// colour, with vertices written into buffers that were allocated with the
+// atlas, so drawing text never allocates
+
+#define GLYPH_ATLAS_WIDTH 512
+#define GLYPH_TEXT_MAX 128 // characters per drawText call, the rest is cut off
+
+typedef struct Glyph
+{
+    SDL_Rect source; // in the atlas, w == 0 for glyphs with nothing to draw
+    int left, top; // where source goes relative to the pen and the top of the line
+    int advance; // pen movement to the next glyph
+} Glyph;
+
+typedef struct GlyphAtlas
+{
+    SDL_Texture* texture;
+    int width, height;
+    int lineHeight;
+    Glyph glyphs[GLYPH_LAST - GLYPH_FIRST + 1];
+    std::vector<SDL_Vertex> vertices; // 4 per character
+    std::vector<int> indices; // 6 per character, two triangles per quad, filled once
+} GlyphAtlas;
+
+bool createGlyphAtlas(GlyphAtlas* atlas, SDL_Renderer* renderer, TTF_Font* font);
+
+// the same from a font compiled into the program, no file or FreeType involved
+bool createBitmapGlyphAtlas(GlyphAtlas* atlas, SDL_Renderer* renderer, const BitmapFont* font);
+
+void destroyGlyphAtlas(GlyphAtlas* atlas);
+
+// width in pixels of text as drawText would draw it
+int textWidth(const GlyphAtlas* atlas, const char* text);
+
+// top left corner of the text at (x, y); characters outside the atlas are skipped
+void drawText(SDL_Renderer* renderer, GlyphAtlas* atlas, const char* text, int x, int y, SDL_Color color);
+
+// the same recorded into a batch in its current colour, where it shares one
+// SDL_RenderGeometry call with all other text of the layer
+void batchText(RenderBatch* batch, const GlyphAtlas* atlas, const char* text, int x, int y);
+
+#endif
@@ -0,0 +1,360 @@
+#include "render_backend.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RENDER_BACKEND_X86 1
+#include <immintrin.h>
+#endif
+
+static SDL_Renderer* softRenderer = NULL;
+
+static SDL_Window* softWindow = NULL;
+
+static SDL_Surface* softFrame = NULL;
+
+static Uint32* softPixels = NULL;
+
+// taken while statics are initialised, just before main runs
+static const std::chrono::steady_clock::time_point processStart = std::chrono::steady_clock::now();
+
+static bool presented = false;
+
+static void fillPixelsScalar(Uint32* dst, int count, Uint32 color)
+{
+    for (int i = 0; i < count; i++)
+    {
+        dst[i] = color;
+    }
+}
+
+#ifdef RENDER_BACKEND_X86
+
+__attribute__((target("avx2"))) static void fillPixelsAVX2(Uint32* dst, int count, Uint32 color)
+{
+    __m256i value = _mm256_set1_epi32((int)color);
+
+    int i = 0;
+
+    for (; i + 32 <= count; i += 32)
+    {
+        _mm256_storeu_si256((__m256i*)(dst + i), value);
+        _mm256_storeu_si256((__m256i*)(dst + i + 8), value);
+        _mm256_storeu_si256((__m256i*)(dst + i + 16), value);
+        _mm256_storeu_si256((__m256i*)(dst + i + 24), value);
+    }
+
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_si256((__m256i*)(dst + i), value);
+    }
+
+    for (; i < count; i++)
+    {
+        dst[i] = color;
+    }
+}
+
+__attribute__((target("sse2"))) static void fillPixelsSSE2(Uint32* dst, int count, Uint32 color)
+{
+    __m128i value = _mm_set1_epi32((int)color);
+
+    int i = 0;
+
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm_storeu_si128((__m128i*)(dst + i), value);
+        _mm_storeu_si128((__m128i*)(dst + i + 4), value);
+        _mm_storeu_si128((__m128i*)(dst + i + 8), value);
+        _mm_storeu_si128((__m128i*)(dst + i + 12), value);
+    }
+
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_si128((__m128i*)(dst + i), value);
+    }
+
+    for (; i < count; i++)
+    {
+        dst[i] = color;
+    }
+}
+
+#endif
+
+typedef void (*FillKernel)(Uint32* dst, int count, Uint32 color);
+
+static FillKernel fillKernel = NULL;
+
+static const char* fillKernelName = "scalar";
+
+static void chooseFillKernel()
+{
+    fillKernel = fillPixelsScalar;
+
+#ifdef RENDER_BACKEND_X86
+    if (SDL_HasAVX2())
+    {
+        fillKernel = fillPixelsAVX2;
+
+        fillKernelName = "avx2";
+    }
+    else if (SDL_HasSSE2())
+    {
+        fillKernel = fillPixelsSSE2;
+
+        fillKernelName = "sse2";
+    }
+#endif
+}
+
+void fillPixels(Uint32* dst, int count, Uint32 color)
+{
+    if (fillKernel == NULL)
+    {
+        chooseFillKernel();
+    }
+
+    fillKernel(dst, count, color);
+}
+
+const char* fillPixelsKernel()
+{
+    if (fillKernel == NULL)
+    {
+        chooseFillKernel();
+    }
+
+    return fillKernelName;
+}
+
+SDL_Renderer* createRenderer(SDL_Window* window, Uint32 flags)
+{
+    const char* backend = SDL_getenv("RENDER_BACKEND");
+
+    if (backend == NULL || strcmp(backend, "software") != 0)
+    {
+        return SDL_CreateRenderer(window, -1, flags);
+    }
+
+    int width, height;
+
+    SDL_GetWindowSize(window, &width, &height);
+
+    softPixels = (Uint32*)SDL_SIMDAlloc((size_t)width * height * sizeof(Uint32));
+
+    if (softPixels == NULL)
+    {
+        SDL_OutOfMemory();
+
+        return NULL;
+    }
+
+    softFrame = SDL_CreateRGBSurfaceWithFormatFrom(softPixels, width, height, 32, width * (int)sizeof(Uint32), SDL_PIXELFORMAT_ARGB8888);
+
+    if (softFrame == NULL)
+    {
+        SDL_SIMDFree(softPixels);
+
+        softPixels = NULL;
+
+        return NULL;
+    }
+
+    // the frame is copied to the window as is, not alpha blended onto it
+    SDL_SetSurfaceBlendMode(softFrame, SDL_BLENDMODE_NONE);
+
+    softRenderer = SDL_CreateSoftwareRenderer(softFrame);
+
+    if (softRenderer == NULL)
+    {
+        SDL_FreeSurface(softFrame);
+
+        SDL_SIMDFree(softPixels);
+
+        softFrame = NULL;
+
+        softPixels = NULL;
+
+        return NULL;
+    }
+
+    softWindow = window;
+
+    printf("Using software renderer (%s fills)\n", fillPixelsKernel());
+
+    return softRenderer;
+}
+
+void destroyRenderer(SDL_Renderer* renderer)
+{
+    SDL_DestroyRenderer(renderer);
+
+    if (renderer == softRenderer)
+    {
+        SDL_FreeSurface(softFrame);
+
+        SDL_SIMDFree(softPixels);
+
+        softRenderer = NULL;
+
+        softWindow = NULL;
+
+        softFrame = NULL;
+
+        softPixels = NULL;
+    }
+}
+
+bool rendererKeepsFrame(SDL_Renderer* renderer)
+{
+    return renderer != NULL && renderer == softRenderer;
+}
+
+// the direct path only knows plain opaque stores into the window frame
+static bool directFill(SDL_Renderer* renderer, bool blended, Uint32* color)
+{
+    if (renderer != softRenderer || SDL_GetRenderTarget(renderer) != NULL || SDL_RenderIsClipEnabled(renderer))
+    {
+        return false;
+    }
+
+    Uint8 r, g, b, a;
+
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+
+    if (blended)
+    {
+        SDL_BlendMode mode;
+
+        SDL_GetRenderDrawBlendMode(renderer, &mode);
+
+        if (mode != SDL_BLENDMODE_NONE && !(mode == SDL_BLENDMODE_BLEND && a == 255))
+        {
+            return false;
+        }
+    }
+
+    *color = ((Uint32)a << 24) | ((Uint32)r << 16) | ((Uint32)g << 8) | b;
+
+    // anything SDL still has queued must land in the frame before we write to it
+    SDL_RenderFlush(renderer);
+
+    return true;
+}
+
+static void fillFrameRect(const SDL_Rect* rect, Uint32 color)
+{
+    int left = rect->x < 0 ? 0 : rect->x;
+
+    int top = rect->y < 0 ? 0 : rect->y;
+
+    int right = rect->x + rect->w > softFrame->w ? softFrame->w : rect->x + rect->w;
+
+    int bottom = rect->y + rect->h > softFrame->h ? softFrame->h : rect->y + rect->h;
+
+    if (left >= right)
+    {
+        return;
+    }
+
+    for (int y = top; y < bottom; y++)
+    {
+        fillPixels(softPixels + y * softFrame->w + left, right - left, color);
+    }
+}
+
+void renderClear(SDL_Renderer* renderer)
+{
+    Uint32 color;
+
+    if (!directFill(renderer, false, &color))
+    {
+        SDL_RenderClear(renderer);
+
+        return;
+    }
+
+    fillPixels(softPixels, softFrame->w * softFrame->h, color);
+}
+
+void renderFillRect(SDL_Renderer* renderer, const SDL_Rect* rect)
+{
+    Uint32 color;
+
+    if (!directFill(renderer, true, &color))
+    {
+        SDL_RenderFillRect(renderer, rect);
+
+        return;
+    }
+
+    if (rect == NULL)
+    {
+        fillPixels(softPixels, softFrame->w * softFrame->h, color);
+
+        return;
+    }
+
+    fillFrameRect(rect, color);
+}
+
+void renderFillRects(SDL_Renderer* renderer, const SDL_Rect* rects, int count)
+{
+    Uint32 color;
+
+    if (!directFill(renderer, true, &color))
+    {
+        SDL_RenderFillRects(renderer, rects, count);
+
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        fillFrameRect(&rects[i], color);
+    }
+}
+
+static void reportFirstPresent()
+{
+    if (presented)
+    {
+        return;
+    }
+
+    presented = true;
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - processStart).count();
+
+    printf("startup: %.1f ms from process start to the first present\n", ms);
+}
+
+void renderPresent(SDL_Renderer* renderer)
+{
+    if (renderer != softRenderer)
+    {
+        SDL_RenderPresent(renderer);
+
+        reportFirstPresent();
+
+        return;
+    }
+
+    // flushes whatever SDL drew itself (textures, text) into the frame
+    SDL_RenderPresent(renderer);
+
+    SDL_Surface* windowSurface = SDL_GetWindowSurface(softWindow);
+
+    if (windowSurface == NULL)
+    {
+        return;
+    }
+
+    SDL_BlitSurface(softFrame, NULL, windowSurface, NULL);
+
+    SDL_UpdateWindowSurface(softWindow);
+
+    reportFirstPresent();
+}
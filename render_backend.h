@@ -0,0 +1,35 @@
+#ifndef RENDER_BACKEND_H
+#define RENDER_BACKEND_H
+
+#include <SDL2/SDL.h>
+
+// creates the usual SDL renderer, or with RENDER_BACKEND=software in the
+// environment an SDL software renderer drawing into a CPU owned ARGB8888
+// frame that is shown with SDL_UpdateWindowSurface (no GPU needed)
+SDL_Renderer* createRenderer(SDL_Window* window, Uint32 flags);
+
+void destroyRenderer(SDL_Renderer* renderer);
+
+// true for the software backend, whose frame still holds the last one after a
+// present; with SDL's own renderers the back buffer is undefined by then
+bool rendererKeepsFrame(SDL_Renderer* renderer);
+
+// drop-in replacements for the SDL calls of the same name; on the software
+// backend they fill the frame directly with SIMD stores instead of going
+// through SDL, everything else (textures, render targets) still works as usual
+void renderClear(SDL_Renderer* renderer);
+
+void renderFillRect(SDL_Renderer* renderer, const SDL_Rect* rect);
+
+void renderFillRects(SDL_Renderer* renderer, const SDL_Rect* rects, int count);
+
+// the first call also prints how long the program took to get there
+void renderPresent(SDL_Renderer* renderer);
+
+// writes count copies of color to dst, using AVX2 or SSE2 when the CPU has them
+void fillPixels(Uint32* dst, int count, Uint32 color);
+
+// "avx2", "sse2" or "scalar"
+const char* fillPixelsKernel();
+
+#endif
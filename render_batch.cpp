@@ -0,0 +1,307 @@
+#include "render_batch.h"
+#include <stdio.h>
+#include <algorithm>
+#include "render_backend.h"
+
+void initRenderBatch(RenderBatch* batch)
+{
+    batch->buckets.clear();
+
+    batch->order.clear();
+
+    batch->quadIndices.clear();
+
+    batch->layer = 0;
+
+    batch->blend = SDL_BLENDMODE_NONE;
+
+    batch->color = 0xffffffffu;
+
+    batch->lastBucket = -1;
+
+    batch->submitted = 0;
+
+    batch->flushed = 0;
+
+    batch->lastFlushed = 0;
+
+    batch->frames = 0;
+}
+
+void batchLayer(RenderBatch* batch, int layer)
+{
+    batch->layer = layer;
+}
+
+void batchColor(RenderBatch* batch, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    batch->color = ((Uint32)a << 24) | ((Uint32)r << 16) | ((Uint32)g << 8) | b;
+
+    batch->submitted++;
+}
+
+void batchBlendMode(RenderBatch* batch, SDL_BlendMode blend)
+{
+    batch->blend = blend;
+
+    batch->submitted++;
+}
+
+static bool bucketMatches(const RenderBucket* bucket, RenderBatchKind kind, int layer, SDL_BlendMode blend, SDL_Texture* texture, Uint32 color)
+{
+    return bucket->kind == kind && bucket->layer == layer && bucket->blend == blend && bucket->texture == texture && bucket->color == color;
+}
+
+// the bucket for the current state, usually the one used last
+static RenderBucket* findBucket(RenderBatch* batch, RenderBatchKind kind, SDL_Texture* texture)
+{
+    SDL_BlendMode blend = kind == RENDER_BATCH_QUADS ? SDL_BLENDMODE_NONE : batch->blend;
+
+    Uint32 color = kind == RENDER_BATCH_QUADS ? 0 : batch->color;
+
+    if (batch->lastBucket >= 0 && bucketMatches(&batch->buckets[batch->lastBucket], kind, batch->layer, blend, texture, color))
+    {
+        return &batch->buckets[batch->lastBucket];
+    }
+
+    int count = (int)batch->buckets.size();
+
+    for (int i = 0; i < count; i++)
+    {
+        if (bucketMatches(&batch->buckets[i], kind, batch->layer, blend, texture, color))
+        {
+            batch->lastBucket = i;
+
+            return &batch->buckets[i];
+        }
+    }
+
+    batch->buckets.emplace_back();
+
+    RenderBucket* bucket = &batch->buckets.back();
+
+    bucket->layer = batch->layer;
+
+    bucket->blend = blend;
+
+    bucket->texture = texture;
+
+    bucket->color = color;
+
+    bucket->kind = kind;
+
+    batch->lastBucket = count;
+
+    return bucket;
+}
+
+void batchPoint(RenderBatch* batch, int x, int y)
+{
+    findBucket(batch, RENDER_BATCH_POINTS, NULL)->points.push_back({x, y});
+
+    batch->submitted++;
+}
+
+void batchPoints(RenderBatch* batch, const SDL_Point* points, int count)
+{
+    RenderBucket* bucket = findBucket(batch, RENDER_BATCH_POINTS, NULL);
+
+    bucket->points.insert(bucket->points.end(), points, points + count);
+
+    batch->submitted++;
+}
+
+void batchRect(RenderBatch* batch, const SDL_Rect* rect)
+{
+    findBucket(batch, RENDER_BATCH_RECTS, NULL)->rects.push_back(*rect);
+
+    batch->submitted++;
+}
+
+void batchRects(RenderBatch* batch, const SDL_Rect* rects, int count)
+{
+    RenderBucket* bucket = findBucket(batch, RENDER_BATCH_RECTS, NULL);
+
+    bucket->rects.insert(bucket->rects.end(), rects, rects + count);
+
+    batch->submitted++;
+}
+
+void batchTexture(RenderBatch* batch, SDL_Texture* texture, const SDL_Rect* source, const SDL_Rect* destination)
+{
+    int width, height;
+
+    if (SDL_QueryTexture(texture, NULL, NULL, &width, &height) != 0)
+    {
+        return;
+    }
+
+    SDL_Rect whole = {0, 0, width, height};
+
+    if (source == NULL)
+    {
+        source = &whole;
+    }
+
+    SDL_Color color = {(Uint8)(batch->color >> 16), (Uint8)(batch->color >> 8), (Uint8)batch->color, (Uint8)(batch->color >> 24)};
+
+    float left = (float)destination->x, top = (float)destination->y;
+
+    float right = left + destination->w, bottom = top + destination->h;
+
+    float u0 = (float)source->x / width, v0 = (float)source->y / height;
+
+    float u1 = (float)(source->x + source->w) / width, v1 = (float)(source->y + source->h) / height;
+
+    std::vector<SDL_Vertex>& vertices = findBucket(batch, RENDER_BATCH_QUADS, texture)->vertices;
+
+    vertices.push_back({{left, top}, color, {u0, v0}});
+    vertices.push_back({{right, top}, color, {u1, v0}});
+    vertices.push_back({{left, bottom}, color, {u0, v1}});
+    vertices.push_back({{right, bottom}, color, {u1, v1}});
+
+    batch->submitted++;
+}
+
+static bool bucketEmpty(const RenderBucket& bucket)
+{
+    return bucket.points.empty() && bucket.rects.empty() && bucket.vertices.empty();
+}
+
+static void growQuadIndices(RenderBatch* batch, int quads)
+{
+    for (int i = (int)batch->quadIndices.size() / 6; i < quads; i++)
+    {
+        int quad[6] = {4 * i, 4 * i + 1, 4 * i + 2, 4 * i + 2, 4 * i + 1, 4 * i + 3};
+
+        batch->quadIndices.insert(batch->quadIndices.end(), quad, quad + 6);
+    }
+}
+
+void flushRenderBatch(SDL_Renderer* renderer, RenderBatch* batch)
+{
+    // buckets nothing went into this frame are dropped, the rest keep their storage
+
+    batch->buckets.erase(std::remove_if(batch->buckets.begin(), batch->buckets.end(), bucketEmpty), batch->buckets.end());
+
+    batch->order.clear();
+
+    for (int i = 0; i < (int)batch->buckets.size(); i++)
+    {
+        batch->order.push_back(i);
+    }
+
+    // layer first, then whatever keeps state changes down: blend mode,
+    // texture, colour
+
+    const std::vector<RenderBucket>& buckets = batch->buckets;
+
+    std::sort(batch->order.begin(), batch->order.end(), [&buckets](int a, int b)
+    {
+        const RenderBucket& x = buckets[a];
+
+        const RenderBucket& y = buckets[b];
+
+        if (x.layer != y.layer)
+        {
+            return x.layer < y.layer;
+        }
+
+        if (x.blend != y.blend)
+        {
+            return x.blend < y.blend;
+        }
+
+        if (x.texture != y.texture)
+        {
+            return x.texture < y.texture;
+        }
+
+        if (x.color != y.color)
+        {
+            return x.color < y.color;
+        }
+
+        return x.kind < y.kind;
+    });
+
+    long flushedBefore = batch->flushed;
+
+    bool stateKnown = false;
+
+    SDL_BlendMode blend = SDL_BLENDMODE_NONE;
+
+    Uint32 color = 0;
+
+    for (int i : batch->order)
+    {
+        RenderBucket* bucket = &batch->buckets[i];
+
+        if (bucket->kind == RENDER_BATCH_QUADS)
+        {
+            int quads = (int)bucket->vertices.size() / 4;
+
+            growQuadIndices(batch, quads);
+
+            SDL_RenderGeometry(renderer, bucket->texture, bucket->vertices.data(), 4 * quads, batch->quadIndices.data(), 6 * quads);
+
+            batch->flushed++;
+
+            bucket->vertices.clear();
+
+            continue;
+        }
+
+        if (!stateKnown || bucket->blend != blend)
+        {
+            SDL_SetRenderDrawBlendMode(renderer, bucket->blend);
+
+            blend = bucket->blend;
+
+            batch->flushed++;
+        }
+
+        if (!stateKnown || bucket->color != color)
+        {
+            SDL_SetRenderDrawColor(renderer, (Uint8)(bucket->color >> 16), (Uint8)(bucket->color >> 8), (Uint8)bucket->color, (Uint8)(bucket->color >> 24));
+
+            color = bucket->color;
+
+            batch->flushed++;
+        }
+
+        stateKnown = true;
+
+        if (bucket->kind == RENDER_BATCH_POINTS)
+        {
+            SDL_RenderDrawPoints(renderer, bucket->points.data(), (int)bucket->points.size());
+
+            bucket->points.clear();
+        }
+        else
+        {
+            renderFillRects(renderer, bucket->rects.data(), (int)bucket->rects.size());
+
+            bucket->rects.clear();
+        }
+
+        batch->flushed++;
+    }
+
+    batch->lastBucket = -1;
+
+    batch->lastFlushed = (int)(batch->flushed - flushedBefore);
+
+    batch->frames++;
+
+    if (batch->frames == RENDER_BATCH_REPORT_FRAMES)
+    {
+        printf("batch: %ld calls submitted, %ld flushed per frame\n", batch->submitted / batch->frames, batch->flushed / batch->frames);
+
+        batch->submitted = 0;
+
+        batch->flushed = 0;
+
+        batch->frames = 0;
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef RENDER_BATCH_H
+#define RENDER_BATCH_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// a frame's points, rects (spans are rects) and textured quads recorded
+// instead of drawn. everything with the same layer, blend mode, texture and
+// colour lands in one bucket, and flushRenderBatch draws the buckets in that
+// order with one SDL_RenderDrawPoints, SDL_RenderFillRects or
+// SDL_RenderGeometry call each, setting the colour and blend mode only when
+// they change.
+//
+// buckets of one layer are drawn in state order, not in the order they were
+// recorded, so whatever has to stay on top of something else of another
+// colour or texture goes on a higher layer (batchLayer)
+
+#define RENDER_BATCH_REPORT_FRAMES 300
+
+typedef enum RenderBatchKind
+{
+    RENDER_BATCH_POINTS,
+    RENDER_BATCH_RECTS,
+    RENDER_BATCH_QUADS
+} RenderBatchKind;
+
+typedef struct RenderBucket
+{
+    int layer;
+    SDL_BlendMode blend; // points and rects, quads use their texture's blend mode
+    SDL_Texture* texture; // quads only
+    Uint32 color; // ARGB, points and rects, quads carry it in their vertices
+    RenderBatchKind kind;
+    std::vector<SDL_Point> points;
+    std::vector<SDL_Rect> rects;
+    std::vector<SDL_Vertex> vertices; // 4 per quad
+} RenderBucket;
+
+typedef struct RenderBatch
+{
+    std::vector<RenderBucket> buckets; // kept across frames so their storage is reused
+    std::vector<int> order; // bucket indices sorted by state at flush
+    std::vector<int> quadIndices; // two triangles per quad, grown as needed
+    int layer;
+    SDL_BlendMode blend;
+    Uint32 color;
+    int lastBucket; // where the previous record went, -1 for none
+    long submitted; // calls recorded, including colour and blend changes
+    long flushed; // SDL calls made to draw them
+    int lastFlushed; // SDL calls made by the latest flush
+    int frames;
+} RenderBatch;
+
+void initRenderBatch(RenderBatch* batch);
+
+// state for what is recorded next, like SDL_SetRenderDrawColor and friends
+void batchLayer(RenderBatch* batch, int layer);
+
+void batchColor(RenderBatch* batch, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
+void batchBlendMode(RenderBatch* batch, SDL_BlendMode blend);
+
+void batchPoint(RenderBatch* batch, int x, int y);
+
+void batchPoints(RenderBatch* batch, const SDL_Point* points, int count);
+
+void batchRect(RenderBatch* batch, const SDL_Rect* rect);
+
+void batchRects(RenderBatch* batch, const SDL_Rect* rects, int count);
+
+// source of texture (NULL for all of it) stretched over destination and
+// tinted with the current colour, white for an unchanged copy
+void batchTexture(RenderBatch* batch, SDL_Texture* texture, const SDL_Rect* source, const SDL_Rect* destination);
+
+// draws and empties the batch; call once per frame, every
+// RENDER_BATCH_REPORT_FRAMES frames it prints the calls submitted and flushed
+void flushRenderBatch(SDL_Renderer* renderer, RenderBatch* batch);
+
+#endif
@@ -0,0 +1,129 @@
+#include "replay_viewer.h"
+
+void initReplayViewer(ReplayViewer* viewer, const SnakeReplay* replay, SnakeEngine* engine)
+{
+    initSnakeReplayPlayer(&viewer->player, replay, engine);
+
+    viewer->paused = false;
+
+    viewer->scrubbing = false;
+}
+
+static void seekTo(ReplayViewer* viewer, SnakeEngine* engine, long tick)
+{
+    long last = (long)viewer->player.replay->ticks;
+
+    seekSnakeReplay(&viewer->player, engine, (uint32_t)(tick < 0 ? 0 : tick > last ? last : tick));
+}
+
+static void scrubTo(ReplayViewer* viewer, SnakeEngine* engine, int x, int windowWidth)
+{
+    seekTo(viewer, engine, (long)x * (long)viewer->player.replay->ticks / (windowWidth > 1 ? windowWidth - 1 : 1));
+}
+
+bool handleReplayEvent(ReplayViewer* viewer, SnakeEngine* engine, const SDL_Event* event, int windowWidth)
+{
+    long tick = (long)engine->tick;
+
+    long jump = (long)viewer->player.replay->tickRate * REPLAY_JUMP_SECONDS;
+
+    if (event->type == SDL_MOUSEBUTTONDOWN)
+    {
+        viewer->scrubbing = true;
+
+        scrubTo(viewer, engine, event->button.x, windowWidth);
+
+        return true;
+    }
+
+    if (event->type == SDL_MOUSEBUTTONUP)
+    {
+        viewer->scrubbing = false;
+
+        return false;
+    }
+
+    if (event->type == SDL_MOUSEMOTION && viewer->scrubbing)
+    {
+        scrubTo(viewer, engine, event->motion.x, windowWidth);
+
+        return true;
+    }
+
+    if (event->type != SDL_KEYDOWN)
+    {
+        return false;
+    }
+
+    switch (event->key.keysym.sym)
+    {
+        case SDLK_SPACE:
+            viewer->paused = !viewer->paused;
+
+            return false;
+
+        case SDLK_LEFT:
+            viewer->paused = true;
+
+            seekTo(viewer, engine, tick - 1); // from the keyframe before it
+
+            return true;
+
+        case SDLK_RIGHT:
+            viewer->paused = true;
+
+            seekTo(viewer, engine, tick + 1);
+
+            return true;
+
+        case SDLK_PAGEUP:
+            seekTo(viewer, engine, tick - jump);
+
+            return true;
+
+        case SDLK_PAGEDOWN:
+            seekTo(viewer, engine, tick + jump);
+
+            return true;
+
+        case SDLK_HOME:
+            seekTo(viewer, engine, 0);
+
+            return true;
+
+        case SDLK_END:
+            seekTo(viewer, engine, (long)viewer->player.replay->ticks);
+
+            return true;
+    }
+
+    return false;
+}
+
+void drawReplayBar(RenderBatch* batch, const ReplayViewer* viewer, const SnakeEngine* engine, int windowWidth, int windowHeight)
+{
+    uint32_t ticks = viewer->player.replay->ticks;
+
+    int played = ticks > 0 ? (int)((long)windowWidth * engine->tick / ticks) : windowWidth;
+
+    // the played part and the rest side by side, so neither covers the other
+
+    SDL_Rect rest = {played, windowHeight - REPLAY_BAR_HEIGHT, windowWidth - played, REPLAY_BAR_HEIGHT};
+
+    SDL_Rect bar = {0, windowHeight - REPLAY_BAR_HEIGHT, played, REPLAY_BAR_HEIGHT};
+
+    batchColor(batch, 64, 64, 64, 255);
+
+    batchRect(batch, &rest);
+
+    if (viewer->paused)
+    {
+        batchColor(batch, 255, 200, 0, 255);
+    }
+    else
+    {
+        batchColor(batch, 200, 200, 200, 255);
+    }
+
+    batchRect(batch, &bar);
+}
@@ -0,0 +1,34 @@
+#ifndef REPLAY_VIEWER_H
+#define REPLAY_VIEWER_H
+
+#include <SDL2/SDL.h>
+#include "render_batch.h"
+#include "snake_replay.h"
+
+#define REPLAY_BAR_HEIGHT 4
+#define REPLAY_JUMP_SECONDS 10 // page up / page down
+
+// keyboard and mouse controls for playing a replay in a game window:
+//   space          pause / play
+//   left, right    pause and step one tick back / forward
+//   page up, down  jump REPLAY_JUMP_SECONDS back / forward
+//   home, end      jump to the start / the end
+//   mouse drag     scrub along the bar at the bottom of the window
+typedef struct ReplayViewer
+{
+    SnakeReplayPlayer player;
+    bool paused;
+    bool scrubbing; // a mouse button is held down
+} ReplayViewer;
+
+void initReplayViewer(ReplayViewer* viewer, const SnakeReplay* replay, SnakeEngine* engine);
+
+// returns true when the event moved the engine to another tick, so the
+// snake has nothing to be interpolated from
+bool handleReplayEvent(ReplayViewer* viewer, SnakeEngine* engine, const SDL_Event* event, int windowWidth);
+
+// the position in the recording as a bar along the bottom edge, recorded
+// into batch on its current layer
+void drawReplayBar(RenderBatch* batch, const ReplayViewer* viewer, const SnakeEngine* engine, int windowWidth, int windowHeight);
+
+#endif
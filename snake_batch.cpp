@@ -0,0 +1,639 @@
+#include "snake_batch.h"
+#include <string.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// worker threads that sleep between steps; each owns one shard of boards
+// and the calling thread does shard 0
+struct SnakeWorkerPool
+{
+    std::vector<std::thread> threads;
+    std::mutex lock;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    uint64_t generation;
+    int pending;
+    bool stop;
+};
+
+// the seed of a board's next episode, the same whatever the thread count
+static uint32_t episodeSeed(const SnakeBatch* batch, int board)
+{
+    uint32_t x = batch->seed ^ ((uint32_t)board * 0x9e3779b9u) ^ (batch->episodes[board] * 0x85ebca6bu);
+
+    x ^= x >> 16;
+
+    x *= 0x7feb352du;
+
+    x ^= x >> 15;
+
+    return x;
+}
+
+static void putCell(uint8_t* board, const SnakeRules* rules, SnakeCell cell, uint8_t value)
+{
+    if (cell != SNAKE_NO_CELL)
+    {
+        board[cellRow(cell) * rules->columns + cellColumn(cell)] = value;
+    }
+}
+
+// the bit of a cell in a board's bitmap, as occupancyIndex with the border
+static int gridIndex(const SnakeBatch* batch, int column, int row)
+{
+    return (row + 1) * (batch->rules.columns + 2) + column + 1;
+}
+
+static void setGridBit(uint64_t* grid, int index, bool occupied)
+{
+    if (occupied)
+    {
+        grid[index >> 6] |= (uint64_t)1 << (index & 63);
+    }
+    else
+    {
+        grid[index >> 6] &= ~((uint64_t)1 << (index & 63));
+    }
+}
+
+static uint32_t nextRandom(SnakeBatch* batch, int index)
+{
+    uint32_t x = batch->randoms[index];
+
+    x ^= x << 13;
+
+    x ^= x >> 17;
+
+    x ^= x << 5;
+
+    batch->randoms[index] = x;
+
+    return x;
+}
+
+// takeFreeCell and releaseFreeCell on one board's slab of the free cell sets
+
+static void takeCell(SnakeBatch* batch, int index, SnakeCell cell)
+{
+    SnakeCell* cells = &batch->freeCells[(size_t)index * batch->boardCells];
+
+    int* slots = &batch->freeSlots[(size_t)index * batch->boardCells];
+
+    int columns = batch->rules.columns;
+
+    int slot = slots[cellRow(cell) * columns + cellColumn(cell)];
+
+    if (slot < 0)
+    {
+        return; // already taken, e.g. the head moving onto food
+    }
+
+    SnakeCell last = cells[--batch->freeCounts[index]];
+
+    cells[slot] = last;
+
+    slots[cellRow(last) * columns + cellColumn(last)] = slot;
+
+    slots[cellRow(cell) * columns + cellColumn(cell)] = -1;
+}
+
+static void releaseCell(SnakeBatch* batch, int index, SnakeCell cell)
+{
+    SnakeCell* cells = &batch->freeCells[(size_t)index * batch->boardCells];
+
+    int* slots = &batch->freeSlots[(size_t)index * batch->boardCells];
+
+    int* slot = &slots[cellRow(cell) * batch->rules.columns + cellColumn(cell)];
+
+    if (*slot >= 0)
+    {
+        return;
+    }
+
+    *slot = batch->freeCounts[index]++;
+
+    cells[*slot] = cell;
+}
+
+// puts food on a random free cell, SNAKE_NO_CELL when the board is full
+static SnakeCell placeFood(SnakeBatch* batch, int index)
+{
+    uint32_t random = nextRandom(batch, index);
+
+    if (batch->freeCounts[index] == 0)
+    {
+        return SNAKE_NO_CELL;
+    }
+
+    SnakeCell cell = batch->freeCells[(size_t)index * batch->boardCells + random % (uint32_t)batch->freeCounts[index]];
+
+    takeCell(batch, index, cell);
+
+    return cell;
+}
+
+// takes uneaten food off the board, its cell is free again
+static void removeFood(SnakeBatch* batch, int index, SnakeCell* food)
+{
+    if (*food != SNAKE_NO_CELL)
+    {
+        releaseCell(batch, index, *food);
+    }
+
+    *food = SNAKE_NO_CELL;
+}
+
+// resetSnakeEngine for one board
+static void resetBoard(SnakeBatch* batch, int index, uint32_t seed)
+{
+    const SnakeRules* rules = &batch->rules;
+
+    uint64_t* grid = &batch->grids[(size_t)index * batch->gridWords];
+
+    memcpy(grid, batch->emptyGrid.data(), batch->gridWords * sizeof(uint64_t));
+
+    SnakeCell* cells = &batch->freeCells[(size_t)index * batch->boardCells];
+
+    int* slots = &batch->freeSlots[(size_t)index * batch->boardCells];
+
+    for (int row = 0, cell = 0; row < rules->rows; row++)
+    {
+        for (int column = 0; column < rules->columns; column++, cell++)
+        {
+            slots[cell] = cell;
+
+            cells[cell] = packCell(column, row);
+        }
+    }
+
+    batch->freeCounts[index] = batch->boardCells;
+
+    // the snake starts in the middle, heading right, its tail at the start of the ring
+
+    SnakeCell* ring = &batch->rings[(size_t)index * (batch->ringMask + 1)];
+
+    for (int i = 0; i < SNAKE_START_LENGTH; i++)
+    {
+        int column = rules->columns / 2 - i;
+
+        int row = rules->rows / 2;
+
+        ring[SNAKE_START_LENGTH - 1 - i] = packCell(column, row);
+
+        setGridBit(grid, gridIndex(batch, column, row), true);
+
+        takeCell(batch, index, packCell(column, row));
+    }
+
+    batch->heads[index] = SNAKE_START_LENGTH - 1;
+
+    batch->tails[index] = 0;
+
+    batch->pendingGrowth[index] = 0;
+
+    batch->dirX[index] = 1;
+
+    batch->dirY[index] = 0;
+
+    batch->lastTail[index] = ring[0];
+
+    batch->scores[index] = 0;
+
+    batch->foodsEaten[index] = 0;
+
+    batch->ticks[index] = 0;
+
+    batch->randoms[index] = seed * 2654435761u ^ 0x9e3779b9u; // xorshift must not start at 0
+
+    if (batch->randoms[index] == 0)
+    {
+        batch->randoms[index] = 1;
+    }
+
+    batch->bonusFood[index] = SNAKE_NO_CELL;
+
+    batch->poisonFood[index] = SNAKE_NO_CELL;
+
+    batch->poisonExpiry[index] = 0;
+
+    batch->food[index] = placeFood(batch, index);
+}
+
+// redraws a whole board, after a reset
+static void writeObservation(SnakeBatch* batch, int index)
+{
+    const SnakeRules* rules = &batch->rules;
+
+    uint8_t* board = &batch->observations[(size_t)index * batch->boardCells];
+
+    memset(board, SNAKE_OBS_EMPTY, batch->boardCells);
+
+    const SnakeCell* ring = &batch->rings[(size_t)index * (batch->ringMask + 1)];
+
+    for (uint32_t i = batch->tails[index]; i != batch->heads[index]; i = (i + 1) & batch->ringMask)
+    {
+        putCell(board, rules, ring[i], SNAKE_OBS_BODY);
+    }
+
+    putCell(board, rules, ring[batch->heads[index]], SNAKE_OBS_HEAD);
+
+    putCell(board, rules, batch->food[index], SNAKE_OBS_FOOD);
+
+    putCell(board, rules, batch->bonusFood[index], SNAKE_OBS_BONUS);
+
+    putCell(board, rules, batch->poisonFood[index], SNAKE_OBS_POISON);
+}
+
+// one stepSnakeEngine tick of a board that is still playing, the same events
+static int moveBoard(SnakeBatch* batch, int index, SnakeAction action)
+{
+    const SnakeRules* rules = &batch->rules;
+
+    // turning back onto the body is ignored
+
+    if ((action == SNAKE_UP || action == SNAKE_DOWN) && batch->dirY[index] == 0)
+    {
+        batch->dirX[index] = 0;
+
+        batch->dirY[index] = action == SNAKE_UP ? -1 : 1;
+    }
+
+    else if ((action == SNAKE_LEFT || action == SNAKE_RIGHT) && batch->dirX[index] == 0)
+    {
+        batch->dirX[index] = action == SNAKE_LEFT ? -1 : 1;
+
+        batch->dirY[index] = 0;
+    }
+
+    SnakeCell* ring = &batch->rings[(size_t)index * (batch->ringMask + 1)];
+
+    uint64_t* grid = &batch->grids[(size_t)index * batch->gridWords];
+
+    int headColumn = cellColumn(ring[batch->heads[index]]) + batch->dirX[index];
+
+    int headRow = cellRow(ring[batch->heads[index]]) + batch->dirY[index];
+
+    SnakeCell head = packCell(headColumn, headRow);
+
+    SnakeCell tail = ring[batch->tails[index]];
+
+    bool tailLeaves = batch->pendingGrowth[index] == 0;
+
+    int bit = gridIndex(batch, headColumn, headRow);
+
+    if (((grid[bit >> 6] >> (bit & 63)) & 1) && !(tailLeaves && head == tail))
+    {
+        return SNAKE_DIED;
+    }
+
+    batch->ticks[index]++;
+
+    if (tailLeaves)
+    {
+        setGridBit(grid, gridIndex(batch, cellColumn(tail), cellRow(tail)), false);
+
+        releaseCell(batch, index, tail);
+
+        batch->tails[index] = (batch->tails[index] + 1) & batch->ringMask;
+    }
+    else
+    {
+        batch->pendingGrowth[index]--;
+    }
+
+    setGridBit(grid, bit, true);
+
+    takeCell(batch, index, head);
+
+    batch->lastTail[index] = tail;
+
+    batch->heads[index] = (batch->heads[index] + 1) & batch->ringMask;
+
+    ring[batch->heads[index]] = head;
+
+    int events = 0;
+
+    if (head == batch->food[index])
+    {
+        events |= SNAKE_ATE_FOOD;
+
+        batch->scores[index] += rules->foodScore;
+
+        batch->pendingGrowth[index]++;
+
+        batch->foodsEaten[index]++;
+
+        batch->food[index] = placeFood(batch, index);
+
+        if (rules->bonusEvery > 0 && batch->foodsEaten[index] % rules->bonusEvery == 0)
+        {
+            removeFood(batch, index, &batch->bonusFood[index]); // an uneaten bonus moves
+
+            batch->bonusFood[index] = placeFood(batch, index);
+        }
+
+        if (rules->poisonEvery > 0 && batch->foodsEaten[index] % rules->poisonEvery == 0 && batch->poisonFood[index] == SNAKE_NO_CELL)
+        {
+            batch->poisonFood[index] = placeFood(batch, index);
+
+            batch->poisonExpiry[index] = batch->ticks[index] + rules->poisonTicks;
+        }
+    }
+
+    if (batch->bonusFood[index] != SNAKE_NO_CELL && head == batch->bonusFood[index])
+    {
+        events |= SNAKE_ATE_BONUS;
+
+        batch->scores[index] += rules->bonusScore;
+
+        batch->pendingGrowth[index] += rules->bonusGrowth;
+
+        batch->bonusFood[index] = SNAKE_NO_CELL; // the head has its cell now
+    }
+
+    if (batch->poisonFood[index] != SNAKE_NO_CELL && head == batch->poisonFood[index])
+    {
+        events |= SNAKE_ATE_POISON;
+
+        batch->scores[index] -= rules->poisonPenalty;
+
+        batch->poisonFood[index] = SNAKE_NO_CELL;
+    }
+
+    if (batch->poisonFood[index] != SNAKE_NO_CELL && batch->ticks[index] >= batch->poisonExpiry[index])
+    {
+        removeFood(batch, index, &batch->poisonFood[index]);
+    }
+
+    if (batch->scores[index] < 0)
+    {
+        events |= SNAKE_DIED;
+    }
+
+    return events;
+}
+
+static void stepBoard(SnakeBatch* batch, int index)
+{
+    const SnakeRules* rules = &batch->rules;
+
+    const SnakeCell* ring = &batch->rings[(size_t)index * (batch->ringMask + 1)];
+
+    SnakeCell oldHead = ring[batch->heads[index]];
+
+    SnakeCell food[3] = {batch->food[index], batch->bonusFood[index], batch->poisonFood[index]};
+
+    int oldScore = batch->scores[index];
+
+    int events = moveBoard(batch, index, (SnakeAction)batch->actions[index]);
+
+    batch->rewards[index] = (float)(batch->scores[index] - oldScore);
+
+    if (events & SNAKE_DIED)
+    {
+        batch->dones[index] = 1;
+
+        batch->finalScores[index] = batch->scores[index];
+
+        batch->episodes[index]++;
+
+        resetBoard(batch, index, episodeSeed(batch, index));
+
+        writeObservation(batch, index);
+
+        return;
+    }
+
+    batch->dones[index] = 0;
+
+    // only the cells that changed: old food and the left tail cell are cleared
+    // first, so the head and the new food land on top
+
+    uint8_t* board = &batch->observations[(size_t)index * batch->boardCells];
+
+    for (int i = 0; i < 3; i++)
+    {
+        putCell(board, rules, food[i], SNAKE_OBS_EMPTY);
+    }
+
+    if (ring[batch->tails[index]] != batch->lastTail[index])
+    {
+        putCell(board, rules, batch->lastTail[index], SNAKE_OBS_EMPTY);
+    }
+
+    putCell(board, rules, oldHead, SNAKE_OBS_BODY);
+
+    putCell(board, rules, ring[batch->heads[index]], SNAKE_OBS_HEAD);
+
+    putCell(board, rules, batch->food[index], SNAKE_OBS_FOOD);
+
+    putCell(board, rules, batch->bonusFood[index], SNAKE_OBS_BONUS);
+
+    putCell(board, rules, batch->poisonFood[index], SNAKE_OBS_POISON);
+}
+
+static void stepShard(SnakeBatch* batch, int shard)
+{
+    int shards = snakeBatchThreads(batch);
+
+    int begin = (int)((long)batch->count * shard / shards);
+
+    int end = (int)((long)batch->count * (shard + 1) / shards);
+
+    for (int i = begin; i < end; i++)
+    {
+        stepBoard(batch, i);
+    }
+}
+
+static void runWorker(SnakeBatch* batch, int shard)
+{
+    SnakeWorkerPool* pool = batch->pool;
+
+    uint64_t seen = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> guard(pool->lock);
+
+            pool->wake.wait(guard, [&] { return pool->stop || pool->generation != seen; });
+
+            if (pool->stop)
+            {
+                return;
+            }
+
+            seen = pool->generation;
+        }
+
+        stepShard(batch, shard);
+
+        std::lock_guard<std::mutex> guard(pool->lock);
+
+        if (--pool->pending == 0)
+        {
+            pool->finished.notify_one();
+        }
+    }
+}
+
+void initSnakeBatch(SnakeBatch* batch, const SnakeRules* rules, int count, int threads, uint32_t seed)
+{
+    batch->rules = *rules;
+
+    batch->count = count;
+
+    batch->boardCells = rules->columns * rules->rows;
+
+    batch->seed = seed;
+
+    uint32_t ringSize = 1;
+
+    while ((int)ringSize < batch->boardCells)
+    {
+        ringSize *= 2;
+    }
+
+    batch->ringMask = ringSize - 1;
+
+    // the empty bitmap is built the way initOccupancy builds it
+
+    OccupancyGrid empty;
+
+    initOccupancy(&empty, rules->columns, rules->rows);
+
+    batch->emptyGrid = empty.bits;
+
+    batch->gridWords = (int)empty.bits.size();
+
+    batch->rings.assign((size_t)count * ringSize, SNAKE_NO_CELL);
+
+    batch->grids.assign((size_t)count * batch->gridWords, 0);
+
+    batch->freeCells.assign((size_t)count * batch->boardCells, SNAKE_NO_CELL);
+
+    batch->freeSlots.assign((size_t)count * batch->boardCells, -1);
+
+    batch->freeCounts.assign(count, 0);
+
+    batch->heads.assign(count, 0);
+
+    batch->tails.assign(count, 0);
+
+    batch->pendingGrowth.assign(count, 0);
+
+    batch->dirX.assign(count, 0);
+
+    batch->dirY.assign(count, 0);
+
+    batch->food.assign(count, SNAKE_NO_CELL);
+
+    batch->bonusFood.assign(count, SNAKE_NO_CELL);
+
+    batch->poisonFood.assign(count, SNAKE_NO_CELL);
+
+    batch->poisonExpiry.assign(count, 0);
+
+    batch->lastTail.assign(count, SNAKE_NO_CELL);
+
+    batch->scores.assign(count, 0);
+
+    batch->foodsEaten.assign(count, 0);
+
+    batch->ticks.assign(count, 0);
+
+    batch->randoms.assign(count, 0);
+
+    batch->observations.assign((size_t)count * batch->boardCells, SNAKE_OBS_EMPTY);
+
+    batch->rewards.assign(count, 0.0f);
+
+    batch->dones.assign(count, 0);
+
+    batch->finalScores.assign(count, 0);
+
+    batch->episodes.assign(count, 0);
+
+    batch->actions = NULL;
+
+    for (int i = 0; i < count; i++)
+    {
+        resetBoard(batch, i, episodeSeed(batch, i));
+
+        writeObservation(batch, i);
+    }
+
+    if (threads <= 0)
+    {
+        threads = (int)std::thread::hardware_concurrency();
+    }
+
+    threads = threads < 1 ? 1 : threads > count ? count : threads;
+
+    batch->pool = new SnakeWorkerPool;
+
+    batch->pool->generation = 0;
+
+    batch->pool->pending = 0;
+
+    batch->pool->stop = false;
+
+    for (int shard = 1; shard < threads; shard++)
+    {
+        batch->pool->threads.push_back(std::thread(runWorker, batch, shard));
+    }
+}
+
+void destroySnakeBatch(SnakeBatch* batch)
+{
+    {
+        std::lock_guard<std::mutex> guard(batch->pool->lock);
+
+        batch->pool->stop = true;
+    }
+
+    batch->pool->wake.notify_all();
+
+    for (std::thread& thread : batch->pool->threads)
+    {
+        thread.join();
+    }
+
+    delete batch->pool;
+
+    batch->pool = NULL;
+}
+
+int snakeBatchThreads(const SnakeBatch* batch)
+{
+    return (int)batch->pool->threads.size() + 1;
+}
+
+void stepSnakeBatch(SnakeBatch* batch, const uint8_t* actions)
+{
+    SnakeWorkerPool* pool = batch->pool;
+
+    batch->actions = actions;
+
+    if (!pool->threads.empty())
+    {
+        std::lock_guard<std::mutex> guard(pool->lock);
+
+        pool->pending = (int)pool->threads.size();
+
+        pool->generation++;
+    }
+
+    pool->wake.notify_all();
+
+    stepShard(batch, 0);
+
+    if (!pool->threads.empty())
+    {
+        std::unique_lock<std::mutex> guard(pool->lock);
+
+        pool->finished.wait(guard, [&] { return pool->pending == 0; });
+    }
+}
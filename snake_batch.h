@@ -0,0 +1,82 @@
+#ifndef SNAKE_BATCH_H
+#define SNAKE_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "snake_engine.h"
+
+// many independent snake boards stepped in lockstep, for training agents:
+// one action per board goes in, and rewards, done flags and an observation
+// tensor come out as flat arrays the caller can read in place; finished
+// boards start a new episode on their own
+
+// observation values, one byte per cell
+#define SNAKE_OBS_EMPTY 0
+#define SNAKE_OBS_BODY 1
+#define SNAKE_OBS_HEAD 2
+#define SNAKE_OBS_FOOD 3
+#define SNAKE_OBS_BONUS 4
+#define SNAKE_OBS_POISON 5
+
+struct SnakeWorkerPool;
+
+typedef struct SnakeBatch
+{
+    SnakeRules rules;
+    int count;
+    int boardCells; // columns * rows
+    uint32_t seed;
+
+    // the boards' state with one array per field, board i at index i, stepped
+    // with the rules of stepSnakeEngine; the body rings, occupancy bitmaps and
+    // free cell sets are slabs of one fixed stride per board
+    uint32_t ringMask; // ring stride - 1, a power of two of at least boardCells
+    int gridWords; // 64 bit words per occupancy bitmap, border included
+    std::vector<SnakeCell> rings; // count rings, the head at heads[i] and the tail at tails[i]
+    std::vector<uint64_t> grids; // count bitmaps laid out like OccupancyGrid
+    std::vector<uint64_t> emptyGrid; // just the border, copied in on a reset
+    std::vector<SnakeCell> freeCells; // boardCells per board, the first freeCounts[i] in use
+    std::vector<int> freeSlots; // boardCells per board, -1 while the cell is taken
+    std::vector<int> freeCounts;
+    std::vector<uint32_t> heads, tails;
+    std::vector<int> pendingGrowth;
+    std::vector<int8_t> dirX, dirY;
+    std::vector<SnakeCell> food, bonusFood, poisonFood; // SNAKE_NO_CELL while not on the board
+    std::vector<uint32_t> poisonExpiry;
+    std::vector<SnakeCell> lastTail;
+    std::vector<int> scores;
+    std::vector<int> foodsEaten;
+    std::vector<uint32_t> ticks;
+    std::vector<uint32_t> randoms; // xorshift state
+
+    std::vector<uint8_t> observations; // count boards of rows x columns bytes
+    std::vector<float> rewards; // score change of the last step
+    std::vector<uint8_t> dones; // 1 when the last step ended the episode (the board is already reset)
+    std::vector<int> finalScores; // score of the episode that just ended, where done
+    std::vector<uint32_t> episodes; // episodes finished per board
+    const uint8_t* actions; // of the step in progress
+    SnakeWorkerPool* pool;
+} SnakeBatch;
+
+// threads 0 picks one per core; the boards are split into one shard per thread
+void initSnakeBatch(SnakeBatch* batch, const SnakeRules* rules, int count, int threads, uint32_t seed);
+
+void destroySnakeBatch(SnakeBatch* batch);
+
+// actions holds one SnakeAction per board
+void stepSnakeBatch(SnakeBatch* batch, const uint8_t* actions);
+
+inline const uint8_t* snakeObservations(const SnakeBatch* batch)
+{
+    return batch->observations.data();
+}
+
+inline const uint8_t* snakeBoardObservation(const SnakeBatch* batch, int board)
+{
+    return batch->observations.data() + (size_t)board * batch->boardCells;
+}
+
+int snakeBatchThreads(const SnakeBatch* batch);
+
+#endif
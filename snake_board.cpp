@@ -0,0 +1,121 @@
+#include "snake_board.h"
+
+void initOccupancy(OccupancyGrid* grid, int columns, int rows)
+{
+    grid->columns = columns;
+
+    grid->rows = rows;
+
+    grid->stride = columns + 2;
+
+    int cells = grid->stride * (rows + 2);
+
+    grid->bits.assign((cells + 63) / 64, 0);
+
+    // the border counts as occupied
+
+    for (int column = -1; column <= columns; column++)
+    {
+        occupyCell(grid, column, -1);
+
+        occupyCell(grid, column, rows);
+    }
+
+    for (int row = 0; row < rows; row++)
+    {
+        occupyCell(grid, -1, row);
+
+        occupyCell(grid, columns, row);
+    }
+}
+
+void initFreeCells(FreeCells* freeCells, int columns, int rows)
+{
+    freeCells->columns = columns;
+
+    freeCells->rows = rows;
+
+    // written in place rather than appended, a batch resets boards all the time
+
+    freeCells->cells.resize(columns * rows);
+
+    freeCells->slot.resize(columns * rows);
+
+    SnakeCell* cells = freeCells->cells.data();
+
+    int* slot = freeCells->slot.data();
+
+    for (int row = 0, index = 0; row < rows; row++)
+    {
+        for (int column = 0; column < columns; column++, index++)
+        {
+            slot[index] = index;
+
+            cells[index] = packCell(column, row);
+        }
+    }
+}
+
+void restoreFreeCells(FreeCells* freeCells, int columns, int rows, const SnakeCell* cells, int count)
+{
+    freeCells->columns = columns;
+
+    freeCells->rows = rows;
+
+    freeCells->cells.assign(cells, cells + count);
+
+    freeCells->slot.assign(columns * rows, -1);
+
+    for (int i = 0; i < count; i++)
+    {
+        freeCells->slot[cellRow(cells[i]) * columns + cellColumn(cells[i])] = i;
+    }
+}
+
+void takeFreeCell(FreeCells* freeCells, int column, int row)
+{
+    int cell = row * freeCells->columns + column;
+
+    int slot = freeCells->slot[cell];
+
+    if (slot < 0)
+    {
+        return; // already taken, e.g. the head moving onto food
+    }
+
+    // move the last free cell into the hole
+
+    SnakeCell last = freeCells->cells.back();
+
+    freeCells->cells[slot] = last;
+
+    freeCells->slot[cellRow(last) * freeCells->columns + cellColumn(last)] = slot;
+
+    freeCells->cells.pop_back();
+
+    freeCells->slot[cell] = -1;
+}
+
+void releaseFreeCell(FreeCells* freeCells, int column, int row)
+{
+    int cell = row * freeCells->columns + column;
+
+    if (freeCells->slot[cell] >= 0)
+    {
+        return;
+    }
+
+    freeCells->slot[cell] = (int)freeCells->cells.size();
+
+    freeCells->cells.push_back(packCell(column, row));
+}
+
+SnakeCell randomFreeCell(const FreeCells* freeCells, uint32_t random)
+{
+    if (freeCells->cells.empty())
+    {
+        return SNAKE_NO_CELL;
+    }
+
+    return freeCells->cells[random % freeCells->cells.size()];
+}
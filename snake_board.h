@@ -0,0 +1,70 @@
+#ifndef SNAKE_BOARD_H
+#define SNAKE_BOARD_H
+
+#include <stdint.h>
+#include <vector>
+#include "snake_body.h"
+
+// one bit per board cell, set while the snake covers it; the board is framed by
+// a one cell border that is always set, so hitting a wall or the body is the
+// same single bit test (no bounds checks, columns and rows may be -1)
+typedef struct OccupancyGrid
+{
+    int columns, rows;
+    int stride; // columns + 2 border cells
+    std::vector<uint64_t> bits;
+} OccupancyGrid;
+
+void initOccupancy(OccupancyGrid* grid, int columns, int rows);
+
+inline int occupancyIndex(const OccupancyGrid* grid, int column, int row)
+{
+    return (row + 1) * grid->stride + column + 1;
+}
+
+inline bool isCellBlocked(const OccupancyGrid* grid, int column, int row)
+{
+    int index = occupancyIndex(grid, column, row);
+
+    return (grid->bits[index >> 6] >> (index & 63)) & 1;
+}
+
+inline void occupyCell(OccupancyGrid* grid, int column, int row)
+{
+    int index = occupancyIndex(grid, column, row);
+
+    grid->bits[index >> 6] |= (uint64_t)1 << (index & 63);
+}
+
+inline void vacateCell(OccupancyGrid* grid, int column, int row)
+{
+    int index = occupancyIndex(grid, column, row);
+
+    grid->bits[index >> 6] &= ~((uint64_t)1 << (index & 63));
+}
+
+// every board cell that is neither snake nor food, as a dense array plus the
+// slot of each cell in it: taking a cell swaps the last entry into its slot and
+// releasing one appends it, so picking a random free cell is O(1) however full
+// the board is
+typedef struct FreeCells
+{
+    int columns, rows;
+    std::vector<SnakeCell> cells;
+    std::vector<int> slot; // per board cell, -1 while the cell is taken
+} FreeCells;
+
+void initFreeCells(FreeCells* freeCells, int columns, int rows);
+
+// rebuilds the set from a saved cells array, keeping its order so random
+// picks come out the same as before it was saved
+void restoreFreeCells(FreeCells* freeCells, int columns, int rows, const SnakeCell* cells, int count);
+
+void takeFreeCell(FreeCells* freeCells, int column, int row);
+
+void releaseFreeCell(FreeCells* freeCells, int column, int row);
+
+// the free cell picked by a random number, SNAKE_NO_CELL when the board is full
+SnakeCell randomFreeCell(const FreeCells* freeCells, uint32_t random);
+
+#endif
@@ -0,0 +1,103 @@
+#include "snake_body.h"
+
+void initSnakeBody(SnakeBody* body)
+{
+    body->cells.assign(SNAKE_INITIAL_CAPACITY, SNAKE_NO_CELL);
+
+    body->mask = SNAKE_INITIAL_CAPACITY - 1;
+
+    body->head = 0;
+
+    body->length = 0;
+
+    body->pendingGrowth = 0;
+}
+
+void clearSnakeBody(SnakeBody* body)
+{
+    body->head = 0;
+
+    body->length = 0;
+
+    body->pendingGrowth = 0;
+}
+
+// doubles the ring, unrolling it so the tail ends up at index 0
+static void expandSnakeBody(SnakeBody* body)
+{
+    std::vector<SnakeCell> cells(body->cells.size() * 2, SNAKE_NO_CELL);
+
+    for (int i = 0; i < body->length; i++)
+    {
+        cells[i] = snakeSegment(body, body->length - 1 - i);
+    }
+
+    body->cells.swap(cells);
+
+    body->mask = (uint32_t)body->cells.size() - 1;
+
+    body->head = body->length > 0 ? (uint32_t)body->length - 1 : body->mask;
+}
+
+void reserveSnakeBody(SnakeBody* body, int segments)
+{
+    while ((int)body->cells.size() < segments)
+    {
+        expandSnakeBody(body);
+    }
+}
+
+void appendSnakeTail(SnakeBody* body, SnakeCell cell)
+{
+    if (body->length == (int)body->cells.size())
+    {
+        expandSnakeBody(body);
+    }
+
+    if (body->length == 0)
+    {
+        body->head = 0;
+
+        body->cells[0] = cell;
+    }
+    else
+    {
+        body->cells[(body->head - (uint32_t)body->length) & body->mask] = cell;
+    }
+
+    body->length++;
+}
+
+SnakeCell moveSnake(SnakeBody* body, SnakeCell cell)
+{
+    if (body->pendingGrowth > 0)
+    {
+        if (body->length == (int)body->cells.size())
+        {
+            expandSnakeBody(body);
+        }
+
+        body->pendingGrowth--;
+
+        body->length++;
+
+        body->head = (body->head + 1) & body->mask;
+
+        body->cells[body->head] = cell;
+
+        return SNAKE_NO_CELL;
+    }
+
+    SnakeCell vacated = snakeTail(body);
+
+    body->head = (body->head + 1) & body->mask;
+
+    body->cells[body->head] = cell;
+
+    return vacated;
+}
+
+void growSnake(SnakeBody* body, int segments)
+{
+    body->pendingGrowth += segments;
+}
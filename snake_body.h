@@ -0,0 +1,73 @@
+#ifndef SNAKE_BODY_H
+#define SNAKE_BODY_H
+
+#include <stdint.h>
+#include <vector>
+
+// board cell packed as (row << 16) | column
+typedef uint32_t SnakeCell;
+
+#define SNAKE_NO_CELL 0xffffffffu
+#define SNAKE_INITIAL_CAPACITY 16
+
+inline SnakeCell packCell(int column, int row)
+{
+    return ((SnakeCell)row << 16) | (SnakeCell)column;
+}
+
+inline int cellColumn(SnakeCell cell)
+{
+    return (int)(cell & 0xffff);
+}
+
+inline int cellRow(SnakeCell cell)
+{
+    return (int)(cell >> 16);
+}
+
+// the body as a ring of cells: a move writes the new head and lets the tail
+// index follow, nothing is shifted; the ring doubles when the snake outgrows it
+typedef struct SnakeBody
+{
+    std::vector<SnakeCell> cells; // size is a power of two
+    uint32_t mask;
+    uint32_t head; // index of the head in cells
+    int length;
+    int pendingGrowth; // moves left on which the tail stays where it is
+} SnakeBody;
+
+void initSnakeBody(SnakeBody* body);
+
+// empties the body but keeps its ring, so a new game reuses the memory
+void clearSnakeBody(SnakeBody* body);
+
+// grows the ring up front so a snake of up to segments cells never reallocates
+void reserveSnakeBody(SnakeBody* body, int segments);
+
+// adds a segment behind the current tail, used to lay out the starting snake
+void appendSnakeTail(SnakeBody* body, SnakeCell cell);
+
+// moves the head onto cell and returns the cell the tail left,
+// or SNAKE_NO_CELL when the snake grew instead
+SnakeCell moveSnake(SnakeBody* body, SnakeCell cell);
+
+// the next segments moves leave the tail in place, amortized O(1) each
+void growSnake(SnakeBody* body, int segments);
+
+// 0 is the head, length - 1 the tail
+inline SnakeCell snakeSegment(const SnakeBody* body, int index)
+{
+    return body->cells[(body->head - (uint32_t)index) & body->mask];
+}
+
+inline SnakeCell snakeHead(const SnakeBody* body)
+{
+    return body->cells[body->head];
+}
+
+inline SnakeCell snakeTail(const SnakeBody* body)
+{
+    return snakeSegment(body, body->length - 1);
+}
+
+#endif
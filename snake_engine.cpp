@@ -0,0 +1,268 @@
+#include "snake_engine.h"
+
+void classicSnakeRules(SnakeRules* rules, int columns, int rows)
+{
+    rules->columns = columns;
+
+    rules->rows = rows;
+
+    rules->foodScore = 10;
+
+    rules->bonusEvery = 5;
+
+    rules->bonusScore = 50;
+
+    rules->bonusGrowth = 2;
+
+    rules->poisonEvery = 0;
+
+    rules->poisonPenalty = 0;
+
+    rules->poisonTicks = 0;
+}
+
+void poisonSnakeRules(SnakeRules* rules, int columns, int rows, int poisonTicks)
+{
+    classicSnakeRules(rules, columns, rows);
+
+    rules->bonusEvery = 0;
+
+    rules->poisonEvery = 4;
+
+    rules->poisonPenalty = 10;
+
+    rules->poisonTicks = poisonTicks;
+}
+
+static uint32_t nextRandom(SnakeEngine* engine)
+{
+    uint32_t x = engine->random;
+
+    x ^= x << 13;
+
+    x ^= x >> 17;
+
+    x ^= x << 5;
+
+    engine->random = x;
+
+    return x;
+}
+
+// puts food on a random free cell, SNAKE_NO_CELL when the board is full
+static SnakeCell placeFood(SnakeEngine* engine)
+{
+    SnakeCell cell = randomFreeCell(&engine->freeCells, nextRandom(engine));
+
+    if (cell != SNAKE_NO_CELL)
+    {
+        takeFreeCell(&engine->freeCells, cellColumn(cell), cellRow(cell));
+    }
+
+    return cell;
+}
+
+// takes uneaten food off the board, its cell is free again
+static void removeFood(SnakeEngine* engine, SnakeCell* food)
+{
+    if (*food != SNAKE_NO_CELL)
+    {
+        releaseFreeCell(&engine->freeCells, cellColumn(*food), cellRow(*food));
+    }
+
+    *food = SNAKE_NO_CELL;
+}
+
+void initSnakeEngine(SnakeEngine* engine, const SnakeRules* rules, uint32_t seed)
+{
+    engine->rules = *rules;
+
+    initSnakeBody(&engine->body);
+
+    reserveSnakeBody(&engine->body, rules->columns * rules->rows);
+
+    resetSnakeEngine(engine, seed);
+}
+
+void resetSnakeEngine(SnakeEngine* engine, uint32_t seed)
+{
+    const SnakeRules* rules = &engine->rules;
+
+    clearSnakeBody(&engine->body);
+
+    initOccupancy(&engine->occupancy, rules->columns, rules->rows);
+
+    initFreeCells(&engine->freeCells, rules->columns, rules->rows);
+
+    // the snake starts in the middle, heading right
+
+    for (int i = 0; i < SNAKE_START_LENGTH; i++)
+    {
+        int column = rules->columns / 2 - i;
+
+        int row = rules->rows / 2;
+
+        appendSnakeTail(&engine->body, packCell(column, row));
+
+        occupyCell(&engine->occupancy, column, row);
+
+        takeFreeCell(&engine->freeCells, column, row);
+    }
+
+    engine->dirX = 1;
+
+    engine->dirY = 0;
+
+    engine->lastTail = snakeTail(&engine->body);
+
+    engine->score = 0;
+
+    engine->foodsEaten = 0;
+
+    engine->tick = 0;
+
+    engine->random = seed * 2654435761u ^ 0x9e3779b9u; // xorshift must not start at 0
+
+    if (engine->random == 0)
+    {
+        engine->random = 1;
+    }
+
+    engine->over = false;
+
+    engine->bonusFood = SNAKE_NO_CELL;
+
+    engine->poisonFood = SNAKE_NO_CELL;
+
+    engine->poisonExpiry = 0;
+
+    engine->food = placeFood(engine);
+}
+
+int stepSnakeEngine(SnakeEngine* engine, SnakeAction action)
+{
+    if (engine->over)
+    {
+        return SNAKE_DIED;
+    }
+
+    const SnakeRules* rules = &engine->rules;
+
+    // turning back onto the body is ignored
+
+    if ((action == SNAKE_UP || action == SNAKE_DOWN) && engine->dirY == 0)
+    {
+        engine->dirX = 0;
+
+        engine->dirY = action == SNAKE_UP ? -1 : 1;
+    }
+
+    else if ((action == SNAKE_LEFT || action == SNAKE_RIGHT) && engine->dirX == 0)
+    {
+        engine->dirX = action == SNAKE_LEFT ? -1 : 1;
+
+        engine->dirY = 0;
+    }
+
+    // the body follows the head by itself since only the head and tail of the ring change
+
+    int headColumn = cellColumn(snakeHead(&engine->body)) + engine->dirX;
+
+    int headRow = cellRow(snakeHead(&engine->body)) + engine->dirY;
+
+    // the cell the head moves into must be free of walls and body, except for
+    // the one the tail leaves this tick. a fatal move keeps the turn and nothing else
+
+    SnakeCell tail = snakeTail(&engine->body);
+
+    bool tailLeaves = engine->body.pendingGrowth == 0;
+
+    if (isCellBlocked(&engine->occupancy, headColumn, headRow) && !(tailLeaves && packCell(headColumn, headRow) == tail))
+    {
+        engine->over = true;
+
+        return SNAKE_DIED;
+    }
+
+    engine->tick++;
+
+    if (tailLeaves)
+    {
+        vacateCell(&engine->occupancy, cellColumn(tail), cellRow(tail));
+
+        releaseFreeCell(&engine->freeCells, cellColumn(tail), cellRow(tail));
+    }
+
+    occupyCell(&engine->occupancy, headColumn, headRow);
+
+    takeFreeCell(&engine->freeCells, headColumn, headRow);
+
+    engine->lastTail = tail;
+
+    SnakeCell head = packCell(headColumn, headRow);
+
+    moveSnake(&engine->body, head);
+
+    int events = 0;
+
+    if (head == engine->food)
+    {
+        events |= SNAKE_ATE_FOOD;
+
+        engine->score += rules->foodScore;
+
+        growSnake(&engine->body, 1);
+
+        engine->foodsEaten++;
+
+        engine->food = placeFood(engine);
+
+        if (rules->bonusEvery > 0 && engine->foodsEaten % rules->bonusEvery == 0)
+        {
+            removeFood(engine, &engine->bonusFood); // an uneaten bonus moves
+
+            engine->bonusFood = placeFood(engine);
+        }
+
+        if (rules->poisonEvery > 0 && engine->foodsEaten % rules->poisonEvery == 0 && engine->poisonFood == SNAKE_NO_CELL)
+        {
+            engine->poisonFood = placeFood(engine);
+
+            engine->poisonExpiry = engine->tick + rules->poisonTicks;
+        }
+    }
+
+    if (engine->bonusFood != SNAKE_NO_CELL && head == engine->bonusFood)
+    {
+        events |= SNAKE_ATE_BONUS;
+
+        engine->score += rules->bonusScore;
+
+        growSnake(&engine->body, rules->bonusGrowth);
+
+        engine->bonusFood = SNAKE_NO_CELL; // the head has its cell now
+    }
+
+    if (engine->poisonFood != SNAKE_NO_CELL && head == engine->poisonFood)
+    {
+        events |= SNAKE_ATE_POISON;
+
+        engine->score -= rules->poisonPenalty;
+
+        engine->poisonFood = SNAKE_NO_CELL;
+    }
+
+    if (engine->poisonFood != SNAKE_NO_CELL && engine->tick >= engine->poisonExpiry)
+    {
+        removeFood(engine, &engine->poisonFood);
+    }
+
+    if (engine->score < 0)
+    {
+        engine->over = true;
+
+        events |= SNAKE_DIED;
+    }
+
+    return events;
+}
@@ -0,0 +1,74 @@
+#ifndef SNAKE_ENGINE_H
+#define SNAKE_ENGINE_H
+
+#include <stdint.h>
+#include "snake_board.h"
+#include "snake_body.h"
+
+// the rules of both snake games without any SDL: one stepSnakeEngine call is
+// one tick, and nothing is allocated after initSnakeEngine
+
+#define SNAKE_START_LENGTH 3
+
+typedef enum SnakeAction
+{
+    SNAKE_KEEP, // carry on in the current direction
+    SNAKE_UP,
+    SNAKE_DOWN,
+    SNAKE_LEFT,
+    SNAKE_RIGHT
+} SnakeAction;
+
+// what happened during a step, or-ed together
+#define SNAKE_ATE_FOOD 1
+#define SNAKE_ATE_BONUS 2
+#define SNAKE_ATE_POISON 4
+#define SNAKE_DIED 8
+
+typedef struct SnakeRules
+{
+    int columns, rows;
+    int foodScore;
+    int bonusEvery; // bonus food after every n foods, 0 for none
+    int bonusScore;
+    int bonusGrowth;
+    int poisonEvery; // poisonous food after every n foods, 0 for none
+    int poisonPenalty;
+    int poisonTicks; // ticks until uneaten poison disappears
+} SnakeRules;
+
+typedef struct SnakeEngine
+{
+    SnakeRules rules;
+    SnakeBody body;
+    OccupancyGrid occupancy;
+    FreeCells freeCells;
+    int dirX, dirY;
+    SnakeCell food, bonusFood, poisonFood; // SNAKE_NO_CELL while not on the board
+    uint32_t poisonExpiry; // tick at which the poison disappears
+    SnakeCell lastTail; // tail before the last step, for interpolating the draw
+    int score;
+    int foodsEaten;
+    uint32_t tick;
+    uint32_t random; // xorshift state
+    bool over;
+} SnakeEngine;
+
+// snake_game: food, and a bonus worth 50 that grows the snake by 2 every 5 foods
+void classicSnakeRules(SnakeRules* rules, int columns, int rows);
+
+// snake_game_task: food, and every 4 foods a poison that costs 10 points and
+// disappears after poisonTicks; the game ends when the score drops below 0
+void poisonSnakeRules(SnakeRules* rules, int columns, int rows, int poisonTicks);
+
+void initSnakeEngine(SnakeEngine* engine, const SnakeRules* rules, uint32_t seed);
+
+// starts a new game on the memory of the old one
+void resetSnakeEngine(SnakeEngine* engine, uint32_t seed);
+
+// turns (a reversal is ignored), moves one cell and applies the rules;
+// returns the SNAKE_ events of the tick. running into a wall or the body ends
+// the game before the move: the tick is not counted and only the turn is kept
+int stepSnakeEngine(SnakeEngine* engine, SnakeAction action);
+
+#endif
@@ -2,17 +2,26 @@
 #include <SDL2/SDL_ttf.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include "board_texture.h"
+#include "embedded_font.h"
+#include "frame_bench.h"
+#include "frame_pacer.h"
+#include "glyph_atlas.h"
+#include "render_backend.h"
+#include "render_batch.h"
+#include "replay_viewer.h"
+#include "snake_engine.h"
 #define SCREEN_WIDTH 640
 #define SCREEN_HEIGHT 480
 #define BLOCK_SIZE 20
+#define FONT_SIZE 24 // for a --font TTF file
+#define DEFAULT_TICK_RATE 10 // snake moves per second
+#define MAX_CATCHUP_TICKS 5 // ticks run in one frame at most before the backlog is dropped
+#define POISON_LIFETIME_MS 4000 // uneaten poisonous food disappears after this much game time
 
-typedef struct SnakeSegment 
-{
-    int x, y;
-} SnakeSegment;
-
-bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer, TTF_Font** font) 
+bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer) 
 {
     if (SDL_Init(SDL_INIT_VIDEO) != 0) 
     {
@@ -21,13 +30,6 @@ bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer, TTF_Font** font
         return false;
     }
 
-    if (TTF_Init() != 0) 
-    {
-        printf("SDL_ttf initialization failed: %s\n", TTF_GetError());
-
-        return false;
-    }
-
     *window = SDL_CreateWindow("Sneaky Snake", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
                                SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN);
 
@@ -38,7 +40,7 @@ bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer, TTF_Font** font
         return false;
     }
 
-    *renderer = SDL_CreateRenderer(*window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    *renderer = createRenderer(*window, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
 
     if (*renderer == NULL) 
     {
@@ -47,114 +49,188 @@ bool initializeSDL(SDL_Window** window, SDL_Renderer** renderer, TTF_Font** font
         return false;
     }
 
-    *font = TTF_OpenFont("arial.ttf", 24); // for the selection of font for scoreboard and game over message
+    return true;
+}
 
-    if (*font == NULL) 
+// the score and game over text use the font compiled in (embedded_font.h), or
+// with --font FILE a TTF file, if it loads; either way its glyphs are rendered
+// once here into an atlas
+bool createTextAtlas(GlyphAtlas* atlas, SDL_Renderer* renderer, const char* fontPath) 
+{
+    if (fontPath != NULL && TTF_Init() == 0) 
     {
-        printf("Font loading failed: %s\n", TTF_GetError());
+        TTF_Font* font = TTF_OpenFont(fontPath, FONT_SIZE);
 
-        return false;
+        if (font != NULL) 
+        {
+            bool created = createGlyphAtlas(atlas, renderer, font);
+
+            TTF_CloseFont(font);
+
+            TTF_Quit();
+
+            return created;
+        }
+
+        printf("Font loading failed, using the built-in font: %s\n", TTF_GetError());
+
+        TTF_Quit();
     }
 
-    return true;
+    return createBitmapGlyphAtlas(atlas, renderer, &embeddedFont);
 }
 
-void renderText(SDL_Renderer* renderer, TTF_Font* font, const char* message, int x, int y, SDL_Color color) 
+int main(int argc, char* argv[]) 
 {
-    SDL_Surface* surface = TTF_RenderText_Solid(font, message, color);
+    SDL_Window* window = NULL;
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_Renderer* renderer = NULL;
 
-    SDL_Rect textRect = {x, y, surface->w, surface->h};
+    if (!initializeSDL(&window, &renderer)) 
+    {
+        return 1;
+    }
 
-    SDL_RenderCopy(renderer, texture, NULL, &textRect);
+    // --tick-rate N sets how many times per second the snake moves, --seed S fixes
+    // the food positions, --record FILE saves the game and --replay FILE plays
+    // a saved one back at the speed it was recorded, with the controls of replay_viewer.h;
+    // --font FILE draws the text with a TTF font instead of the built-in one
 
-    SDL_FreeSurface(surface);
+    int tickRate = DEFAULT_TICK_RATE;
 
-    SDL_DestroyTexture(texture);
-}
+    uint32_t seed = (uint32_t)time(NULL);
 
-void placeFood(int* x, int* y) 
-{
-    *x = (rand() % (SCREEN_WIDTH / BLOCK_SIZE)) * BLOCK_SIZE;
+    const char* recordPath = NULL;
 
-    *y = (rand() % (SCREEN_HEIGHT / BLOCK_SIZE)) * BLOCK_SIZE;
-}
+    const char* replayPath = NULL;
 
-bool checkSelfCollision(SnakeSegment* snake, int snakeLength) 
-{
-    for (int i = 1; i < snakeLength; ++i) 
+    const char* fontPath = NULL;
+
+    for (int i = 1; i + 1 < argc; i++)
     {
-        if (snake[0].x == snake[i].x && snake[0].y == snake[i].y) 
+        if (strcmp(argv[i], "--tick-rate") == 0 && atoi(argv[i + 1]) > 0)
         {
-            return true; // collision detected
+            tickRate = atoi(argv[i + 1]);
         }
-    }
 
-    return false;
-}
+        else if (strcmp(argv[i], "--seed") == 0)
+        {
+            seed = (uint32_t)strtoul(argv[i + 1], NULL, 10);
+        }
 
-int main(int argc, char* argv[]) 
-{
-    SDL_Window* window = NULL;
+        else if (strcmp(argv[i], "--record") == 0)
+        {
+            recordPath = argv[i + 1];
+        }
 
-    SDL_Renderer* renderer = NULL;
+        else if (strcmp(argv[i], "--replay") == 0)
+        {
+            replayPath = argv[i + 1];
+        }
+
+        else if (strcmp(argv[i], "--font") == 0)
+        {
+            fontPath = argv[i + 1];
+        }
+    }
 
-    TTF_Font* font = NULL;
+    GlyphAtlas text;
 
-    if (!initializeSDL(&window, &renderer, &font)) 
+    if (!createTextAtlas(&text, renderer, fontPath)) 
     {
         return 1;
     }
 
-    srand(time(NULL));
+    // everything but the background and the grid texture is recorded per frame and
+    // sent to SDL sorted by colour, see render_batch.h
+
+    RenderBatch batch;
+
+    initRenderBatch(&batch);
+
+    // --grid-texture draws the board as one texture with a texel per cell instead of a rect per segment
+
+    bool gridTexture = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--grid-texture") == 0)
+        {
+            gridTexture = true;
+        }
+    }
+
+    BoardTexture board;
+
+    if (gridTexture && !createBoardTexture(&board, renderer, SCREEN_WIDTH / BLOCK_SIZE, SCREEN_HEIGHT / BLOCK_SIZE)) 
+    {
+        return 1;
+    }
 
     bool running = true;
 
     SDL_Event event;
 
-    // Snake setup
+    // frames are paced to --fps (default 60) unless the renderer already waits for vsync
 
-    SnakeSegment snake[200];
+    FramePacer pacer;
 
-    int snakeLength = 3;
+    initFramePacer(&pacer, renderer, targetFpsFromArguments(argc, argv));
 
-    int snakeDirX = 1, snakeDirY = 0;
+    // --bench N measures N frames and stops (frame_bench.h); the game then runs
+    // on a clock that advances one DEFAULT_TARGET_FPS frame per frame, so a
+    // replay is drawn the same way however fast the frames really are
 
-    // initializing snake position
+    FrameBench bench;
 
-    for (int i = 0; i < snakeLength; ++i) 
-    {
-        snake[i].x = SCREEN_WIDTH / 2 - i * BLOCK_SIZE;
+    initFrameBench(&bench, argc, argv);
 
-        snake[i].y = SCREEN_HEIGHT / 2;
-    }
+    // Snake setup: the rules run in the engine, this loop only feeds it keys and draws it
+
+    SnakeRules rules;
 
-    // for regular food
+    poisonSnakeRules(&rules, SCREEN_WIDTH / BLOCK_SIZE, SCREEN_HEIGHT / BLOCK_SIZE, (POISON_LIFETIME_MS * tickRate + 999) / 1000);
 
-    int foodX, foodY;
+    SnakeEngine game;
 
-    placeFood(&foodX, &foodY);
+    // a game is its seed plus the ticks on which keys were pressed
 
-    // for poisonus food
+    SnakeReplay replay;
 
-    int poisonFoodX = -BLOCK_SIZE; // for starting outside of the screen
+    ReplayViewer viewer;
 
-    int poisonFoodY = -BLOCK_SIZE;
+    if (replayPath != NULL) 
+    {
+        if (!loadSnakeReplay(&replay, replayPath)) 
+        {
+            return 1;
+        }
 
-    bool poisonFoodActive = false;
+        tickRate = replay.tickRate;
 
-    Uint32 poisonFoodTime = 0; // timestamp to track poisonous food appearance time
+        initReplayViewer(&viewer, &replay, &game);
+    } 
+    else 
+    {
+        initSnakeEngine(&game, &rules, seed);
 
-    // for score count
+        initSnakeReplay(&replay, &rules, seed, tickRate);
+    }
 
-    int score = 0;
+    SnakeAction nextAction = SNAKE_KEEP; // last arrow key since the previous tick
 
-    int foodsEaten = 0;
+    // after a move every segment slides in from the cell of the segment behind it,
+    // and the tail from the cell it just left (or stays put when the snake grew)
+
+    bool moved = false;
 
     // timing variables
 
-    Uint32 lastTime = SDL_GetTicks();
+    Uint64 tickLength = SDL_GetPerformanceFrequency() / tickRate;
+
+    Uint64 lastCounter = SDL_GetPerformanceCounter();
+
+    Uint64 accumulator = 0;
 
     while (running) 
     {
@@ -166,196 +242,248 @@ int main(int argc, char* argv[])
             {
                 running = false;
             } 
+            else if (replayPath != NULL) 
+            {
+                if (handleReplayEvent(&viewer, &game, &event, SCREEN_WIDTH)) 
+                {
+                    moved = false; // jumped, draw the snake where it is
+                }
+            }
             else if (event.type == SDL_KEYDOWN) 
             {
                 switch (event.key.keysym.sym) 
                 {
                     case SDLK_UP:
-                        if (snakeDirY == 0) 
-                        {
-                            snakeDirX = 0;
-                            snakeDirY = -1;
-                        }
+                        nextAction = SNAKE_UP;
                         break;
                     case SDLK_DOWN:
-                        if (snakeDirY == 0) 
-                        {
-                            snakeDirX = 0;
-                            snakeDirY = 1;
-                        }
+                        nextAction = SNAKE_DOWN;
                         break;
                     case SDLK_LEFT:
-                        if (snakeDirX == 0) 
-                        {
-                            snakeDirX = -1;
-                            snakeDirY = 0;
-                        }
+                        nextAction = SNAKE_LEFT;
                         break;
                     case SDLK_RIGHT:
-                        if (snakeDirX == 0) 
-                        {
-                            snakeDirX = 1;
-                            snakeDirY = 0;
-                        }
+                        nextAction = SNAKE_RIGHT;
                         break;
                 }
             }
         }
 
-        // game logic for moving the snake
+        // game logic: the accumulator collects real time and every full tickLength
+        // of it moves the snake once, so the speed no longer depends on the frame rate
 
-        Uint32 currentTime = SDL_GetTicks();
+        Uint64 currentCounter = SDL_GetPerformanceCounter();
 
-        if (currentTime - lastTime > 100) 
-        { 
-            lastTime = currentTime;
+        accumulator += benchmarking(&bench) ? SDL_GetPerformanceFrequency() / DEFAULT_TARGET_FPS : currentCounter - lastCounter;
 
-            // for moving snake body
+        lastCounter = currentCounter;
 
-            for (int i = snakeLength - 1; i > 0; --i) 
-            {
-                snake[i] = snake[i - 1];
-            }
-
-            // for moving snake head
-
-            snake[0].x += snakeDirX * BLOCK_SIZE;
+        if (replayPath != NULL && viewer.paused) 
+        {
+            accumulator = 0;
 
-            snake[0].y += snakeDirY * BLOCK_SIZE;
+            moved = false;
+        }
 
-            // for checking collision with regular food
+        int ticksThisFrame = 0;
 
-            if (snake[0].x == foodX && snake[0].y == foodY) 
+        while (running && accumulator >= tickLength) 
+        { 
+            if (ticksThisFrame == MAX_CATCHUP_TICKS) 
             {
-                score += 10;
+                // too far behind (window drag, debugger), drop the backlog instead of spiralling
 
-                snakeLength++;
+                accumulator %= tickLength;
 
-                foodsEaten++;
+                break;
+            }
 
-                placeFood(&foodX, &foodY);
+            accumulator -= tickLength;
 
-                // activate poisonous food after 4 foods eaten
+            ticksThisFrame++;
 
-                if (foodsEaten % 4 == 0 && !poisonFoodActive) 
+            int events = 0;
+
+            if (replayPath != NULL) 
+            {
+                if (snakeReplayFinished(&viewer.player, &game)) 
                 {
-                    placeFood(&poisonFoodX, &poisonFoodY);
+                    viewer.paused = true; // hold the last tick, it can still be scrubbed back
 
-                    poisonFoodActive = true;
+                    accumulator = 0;
 
-                    poisonFoodTime = SDL_GetTicks(); //  time of activation of poisonous food
+                    break;
                 }
-            }
-
-            // for checking collision with poisonous food
 
-            if (poisonFoodActive && snake[0].x == poisonFoodX && snake[0].y == poisonFoodY) 
+                stepSnakeReplay(&viewer.player, &game);
+            } 
+            else 
             {
-                score -= 10; // point subtraction for poisonous food
+                events = stepSnakeEngine(&game, nextAction);
 
-                poisonFoodActive = false;
+                recordSnakeTick(&replay, nextAction, &game);
+            }
 
-                poisonFoodX = -BLOCK_SIZE;
+            if (events & SNAKE_DIED) 
+            {
+                running = false; // into a wall or the body, or the score dropped below 0
 
-                poisonFoodY = -BLOCK_SIZE;
+                break;
             }
 
-            // if poisonous food is active and 4 seconds have passed the poisonous food will disappear
+            nextAction = SNAKE_KEEP;
 
-            if (poisonFoodActive && currentTime - poisonFoodTime >= 4000) 
-            {
-                poisonFoodActive = false;
+            moved = true;
+        }
 
-                poisonFoodX = -BLOCK_SIZE;
+        // how far we are into the next tick, 0 right after a move and close to 1 before the next
 
-                poisonFoodY = -BLOCK_SIZE;
-            }
+        float alpha = (float)accumulator / (float)tickLength;
 
-            // for checking collision with boundaries
+        // Rendering
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
 
-            if (snake[0].x < 0 || snake[0].x >= SCREEN_WIDTH || snake[0].y < 0 || snake[0].y >= SCREEN_HEIGHT) 
-            {
-                running = false;
-            }
+        renderClear(renderer);
 
-            // for checking collision with itself
+        if (gridTexture) 
+        {
+            // one copy for food and snake, only the cells changed by the last tick are uploaded
+
+            updateBoardTexture(&board, &game);
+
+            SDL_Rect boardRect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
 
-            if (checkSelfCollision(snake, snakeLength)) 
+            drawBoardTexture(renderer, &board, &boardRect);
+        } 
+        else 
+        {
+            // for rendering regular food
+            if (game.food != SNAKE_NO_CELL) 
             {
-                running = false;
+                batchColor(&batch, 255, 0, 0, 255);
+
+                SDL_Rect foodRect = {cellColumn(game.food) * BLOCK_SIZE, cellRow(game.food) * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE};
+
+                batchRect(&batch, &foodRect);
             }
 
-            // if score is negative, show game over screen
-            if (score < 0) 
+            // render poisonous food if active
+            if (game.poisonFood != SNAKE_NO_CELL) 
             {
-                running = false;
+                batchColor(&batch, 128, 0, 128, 255); // Poisonous food color (purple)
+
+                SDL_Rect poisonFoodRect = {cellColumn(game.poisonFood) * BLOCK_SIZE, cellRow(game.poisonFood) * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE};
+
+                batchRect(&batch, &poisonFoodRect);
             }
-        }
 
-        // Rendering
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+            // Render snake
+            batchLayer(&batch, 1); // above the food it slides onto
 
-        SDL_RenderClear(renderer);
+            batchColor(&batch, 0, 255, 0, 255);
 
-        // for rendering regular food
-        SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
+            const SnakeBody* snake = &game.body;
 
-        SDL_Rect foodRect = {foodX, foodY, BLOCK_SIZE, BLOCK_SIZE};
+            for (int i = 0; i < snake->length; ++i) 
+            {
+                SnakeCell cell = snakeSegment(snake, i);
 
-        SDL_RenderFillRect(renderer, &foodRect);
+                SnakeCell from = !moved ? cell : i + 1 < snake->length ? snakeSegment(snake, i + 1) : game.lastTail;
 
-        // render poisonous food if active
-        if (poisonFoodActive) 
-        {
-            SDL_SetRenderDrawColor(renderer, 128, 0, 128, 255); // Poisonous food color (purple)
+                int fromX = cellColumn(from) * BLOCK_SIZE;
 
-            SDL_Rect poisonFoodRect = {poisonFoodX, poisonFoodY, BLOCK_SIZE, BLOCK_SIZE};
+                int fromY = cellRow(from) * BLOCK_SIZE;
 
-            SDL_RenderFillRect(renderer, &poisonFoodRect);
-        }
+                int x = fromX + (int)((cellColumn(cell) * BLOCK_SIZE - fromX) * alpha);
+
+                int y = fromY + (int)((cellRow(cell) * BLOCK_SIZE - fromY) * alpha);
+
+                SDL_Rect segmentRect = {x, y, BLOCK_SIZE, BLOCK_SIZE};
 
-        // Render snake
-        SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
+                batchRect(&batch, &segmentRect);
+            }
+        }
 
-        for (int i = 0; i < snakeLength; ++i) 
+        // for the position in the replay
+        if (replayPath != NULL) 
         {
-            SDL_Rect segmentRect = {snake[i].x, snake[i].y, BLOCK_SIZE, BLOCK_SIZE};
+            batchLayer(&batch, 2);
 
-            SDL_RenderFillRect(renderer, &segmentRect);
+            drawReplayBar(&batch, &viewer, &game, SCREEN_WIDTH, SCREEN_HEIGHT);
         }
 
         // Render score
         char scoreText[32];
 
-        sprintf(scoreText, "Score: %d", score);
+        sprintf(scoreText, "Score: %d", game.score);
+
+        batchLayer(&batch, 3);
+
+        batchColor(&batch, 255, 255, 255, 255);
+
+        batchText(&batch, &text, scoreText, 10, 10);
+
+        // food and snake, replay bar, score: a plural call per colour instead of one per cell
+
+        flushRenderBatch(renderer, &batch);
+
+        batchLayer(&batch, 0);
+
+        waitForNextFrame(&pacer);
 
-        renderText(renderer, font, scoreText, 10, 10, (SDL_Color){255, 255, 255, 255});
+        renderPresent(renderer);
 
-        SDL_RenderPresent(renderer);
+        if (!benchFrame(&bench, batch.lastFlushed + (gridTexture ? 1 : 0))) 
+        {
+            running = false;
+        }
+    }
+
+    if (benchmarking(&bench)) 
+    {
+        writeFrameBench(&bench);
     }
 
     // Game over screen
 
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
 
-    SDL_RenderClear(renderer);
+    renderClear(renderer);
 
-    renderText(renderer, font, "Game Over", SCREEN_WIDTH / 2 - 60, SCREEN_HEIGHT / 2 - 20, (SDL_Color){255, 0, 0, 255});
+    drawText(renderer, &text, "Game Over", (SCREEN_WIDTH - textWidth(&text, "Game Over")) / 2, SCREEN_HEIGHT / 2 - 20, (SDL_Color){255, 0, 0, 255});
 
     char finalScore[32];
 
-    sprintf(finalScore, "Final Score: %d", score);
+    sprintf(finalScore, "Final Score: %d", game.score);
 
-    renderText(renderer, font, finalScore, SCREEN_WIDTH / 2 - 80, SCREEN_HEIGHT / 2 + 20, (SDL_Color){255, 255, 255, 255});
+    drawText(renderer, &text, finalScore, (SCREEN_WIDTH - textWidth(&text, finalScore)) / 2, SCREEN_HEIGHT / 2 + 20, (SDL_Color){255, 255, 255, 255});
     
-    SDL_RenderPresent(renderer);
+    renderPresent(renderer);
+
+    if (replayPath != NULL && viewer.player.divergedAt != 0) 
+    {
+        printf("Replay diverged from the recording at tick %u\n", viewer.player.divergedAt);
+    }
+
+    if (recordPath != NULL && saveSnakeReplay(&replay, recordPath)) 
+    {
+        printf("Recorded %u ticks to %s\n", replay.ticks, recordPath);
+    }
+
+    if (!benchmarking(&bench)) 
+    {
+        SDL_Delay(3000); // Pause for 3 seconds
+    }
+
+    if (gridTexture) 
+    {
+        destroyBoardTexture(&board);
+    }
 
-    SDL_Delay(3000); // Pause for 3 seconds
+    destroyGlyphAtlas(&text);
 
-    SDL_DestroyRenderer(renderer);
+    destroyRenderer(renderer);
     SDL_DestroyWindow(window);
-    TTF_CloseFont(font);
-    TTF_Quit();
     SDL_Quit();
 
     return 0;
@@ -0,0 +1,349 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "snake_batch.h"
+#include "snake_engine.h"
+#include "snake_replay.h"
+
+// runs the snake engine without a window as fast as it goes, driven by a
+// greedy bot, and reports ticks per second; with --envs it steps a batch of
+// boards with random actions instead and reports environment steps per second,
+// and with --replay it plays a recorded game back and checks it tick by tick
+
+#define DEFAULT_TICKS 10000000L
+#define DEFAULT_COLUMNS 32 // the 640x480 board of the games
+#define DEFAULT_ROWS 24
+#define REPLAY_MIN_TICKS 1000000 // a short recording is replayed until this many ticks for the timing
+#define REPLAY_SEEKS 1000 // random seeks, each followed by a step back, timed after the check
+#define BOT_TICK_RATE 10 // stored in recordings of the bot, the games' default
+
+long longArgument(int argc, char* argv[], const char* name, long fallback)
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], name) == 0)
+        {
+            return atol(argv[i + 1]);
+        }
+    }
+
+    return fallback;
+}
+
+const char* stringArgument(int argc, char* argv[], const char* name)
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], name) == 0)
+        {
+            return argv[i + 1];
+        }
+    }
+
+    return NULL;
+}
+
+bool hasArgument(int argc, char* argv[], const char* name)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], name) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// heads for the food on a free cell, keeps going when every way is blocked
+SnakeAction chooseAction(const SnakeEngine* engine)
+{
+    static const SnakeAction actions[4] = {SNAKE_UP, SNAKE_DOWN, SNAKE_LEFT, SNAKE_RIGHT};
+
+    static const int stepX[4] = {0, 0, -1, 1};
+
+    static const int stepY[4] = {-1, 1, 0, 0};
+
+    SnakeCell head = snakeHead(&engine->body);
+
+    SnakeCell goal = engine->food != SNAKE_NO_CELL ? engine->food : head;
+
+    SnakeAction best = SNAKE_KEEP;
+
+    int bestDistance = 1 << 30;
+
+    for (int i = 0; i < 4; i++)
+    {
+        int column = cellColumn(head) + stepX[i];
+
+        int row = cellRow(head) + stepY[i];
+
+        if (isCellBlocked(&engine->occupancy, column, row))
+        {
+            continue;
+        }
+
+        int distance = abs(column - cellColumn(goal)) + abs(row - cellRow(goal));
+
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+
+            best = actions[i];
+        }
+    }
+
+    return best;
+}
+
+// steps a batch of boards the way a training loop would: new actions for every
+// board, one lockstep step, read rewards and dones
+int runBatch(const SnakeRules* rules, int envs, int threads, long steps, uint32_t seed)
+{
+    SnakeBatch batch;
+
+    initSnakeBatch(&batch, rules, envs, threads, seed);
+
+    std::vector<uint8_t> actions(envs);
+
+    uint32_t random = seed | 1;
+
+    long episodes = 0;
+
+    double reward = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (long step = 0; step < steps; step++)
+    {
+        for (int i = 0; i < envs; i++)
+        {
+            random ^= random << 13;
+
+            random ^= random >> 17;
+
+            random ^= random << 5;
+
+            actions[i] = (uint8_t)(random % 5); // SNAKE_KEEP ... SNAKE_RIGHT
+        }
+
+        stepSnakeBatch(&batch, actions.data());
+
+        for (int i = 0; i < envs; i++)
+        {
+            episodes += batch.dones[i];
+
+            reward += batch.rewards[i];
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%d boards of %dx%d on %d threads, %ld steps in %.3f s: %.2f M env steps/s\n",
+           envs, rules->columns, rules->rows, snakeBatchThreads(&batch), steps, seconds, (double)envs * steps / seconds / 1e6);
+
+    printf("%ld episodes, total reward %.0f, observations %zu bytes at %p\n",
+           episodes, reward, batch.observations.size(), (const void*)snakeObservations(&batch));
+
+    destroySnakeBatch(&batch);
+
+    return 0;
+}
+
+// re-simulates a recording as fast as possible, checking every tick's checksum
+int runReplay(const char* path)
+{
+    SnakeReplay replay;
+
+    if (!loadSnakeReplay(&replay, path))
+    {
+        return 1;
+    }
+
+    SnakeEngine engine;
+
+    SnakeReplayPlayer player;
+
+    long replayed = 0;
+
+    int passes = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    do
+    {
+        initSnakeReplayPlayer(&player, &replay, &engine);
+
+        while (!snakeReplayFinished(&player, &engine))
+        {
+            stepSnakeReplay(&player, &engine);
+        }
+
+        replayed += engine.tick;
+
+        passes++;
+    }
+    while (player.divergedAt == 0 && engine.tick > 0 && replayed < REPLAY_MIN_TICKS);
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%s: %u ticks, %zu inputs, seed %u, final score %d\n", path, replay.ticks, replay.inputs.size(), replay.seed, engine.score);
+
+    if (player.divergedAt != 0 || engine.tick != replay.ticks)
+    {
+        printf("replay diverged from the recording at tick %u\n", player.divergedAt != 0 ? player.divergedAt : engine.tick);
+
+        return 1;
+    }
+
+    double ticksPerSecond = replayed / seconds;
+
+    printf("all checksums match; %d passes at %.2f M ticks/s, %.0fx real time at %d ticks/s\n",
+           passes, ticksPerSecond / 1e6, ticksPerSecond / replay.tickRate, replay.tickRate);
+
+    // seeking the way the viewer does: jump somewhere, then step back a tick
+
+    srand(replay.seed);
+
+    double worstMs = 0, totalMs = 0;
+
+    for (int i = 0; i < REPLAY_SEEKS; i++)
+    {
+        uint32_t target = (uint32_t)(((long)rand() * (RAND_MAX + 1L) + rand()) % (replay.ticks + 1));
+
+        auto seekStart = std::chrono::steady_clock::now();
+
+        seekSnakeReplay(&player, &engine, target);
+
+        seekSnakeReplay(&player, &engine, target > 0 ? target - 1 : 0);
+
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - seekStart).count();
+
+        totalMs += ms;
+
+        worstMs = ms > worstMs ? ms : worstMs;
+    }
+
+    printf("%zu keyframes every %u ticks; seek and step back %.3f ms on average, %.3f ms worst\n",
+           replay.keyframes.size(), replay.keyframeInterval, totalMs / REPLAY_SEEKS, worstMs);
+
+    if (player.divergedAt != 0)
+    {
+        printf("seeking diverged from the recording at tick %u\n", player.divergedAt);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    long ticks = longArgument(argc, argv, "--ticks", DEFAULT_TICKS);
+
+    int columns = (int)longArgument(argc, argv, "--columns", DEFAULT_COLUMNS);
+
+    int rows = (int)longArgument(argc, argv, "--rows", DEFAULT_ROWS);
+
+    uint32_t seed = (uint32_t)longArgument(argc, argv, "--seed", 1);
+
+    bool poison = hasArgument(argc, argv, "--poison");
+
+    int envs = (int)longArgument(argc, argv, "--envs", 0);
+
+    int threads = (int)longArgument(argc, argv, "--threads", 0);
+
+    const char* recordPath = stringArgument(argc, argv, "--record");
+
+    const char* replayPath = stringArgument(argc, argv, "--replay");
+
+    if (replayPath != NULL)
+    {
+        return runReplay(replayPath);
+    }
+
+    if (ticks <= 0 || columns < SNAKE_START_LENGTH || rows < 1 || columns > 0xffff || rows > 0xffff
+        || (long long)columns * rows > SNAKE_REPLAY_MAX_CELLS)
+    {
+        printf("usage: snake_headless [--ticks N] [--columns C] [--rows R] [--seed S] [--poison] [--envs N [--threads T]] [--record FILE] [--replay FILE]\n");
+
+        return 1;
+    }
+
+    SnakeRules rules;
+
+    if (poison)
+    {
+        poisonSnakeRules(&rules, columns, rows, 40); // 4 seconds at the games' 10 ticks per second
+    }
+    else
+    {
+        classicSnakeRules(&rules, columns, rows);
+    }
+
+    if (envs > 0)
+    {
+        return runBatch(&rules, envs, threads, ticks / envs > 0 ? ticks / envs : 1, seed);
+    }
+
+    SnakeEngine engine;
+
+    initSnakeEngine(&engine, &rules, seed);
+
+    // --record saves the bot's first game
+
+    SnakeReplay replay;
+
+    initSnakeReplay(&replay, &rules, seed, BOT_TICK_RATE);
+
+    long games = 0;
+
+    long scoreTotal = 0;
+
+    int bestScore = 0;
+
+    int longest = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (long tick = 0; tick < ticks; tick++)
+    {
+        SnakeAction action = chooseAction(&engine);
+
+        int events = stepSnakeEngine(&engine, action);
+
+        if (recordPath != NULL && games == 0)
+        {
+            recordSnakeTick(&replay, action, &engine);
+        }
+
+        if (events & SNAKE_DIED)
+        {
+            games++;
+
+            scoreTotal += engine.score;
+
+            bestScore = engine.score > bestScore ? engine.score : bestScore;
+
+            longest = engine.body.length > longest ? engine.body.length : longest;
+
+            resetSnakeEngine(&engine, seed + (uint32_t)games);
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%ld ticks on %dx%d in %.3f s: %.2f M ticks/s\n", ticks, columns, rows, seconds, ticks / seconds / 1e6);
+
+    printf("%ld games, mean score %.1f, best score %d, longest snake %d\n",
+           games, games > 0 ? (double)scoreTotal / games : 0.0, bestScore, longest);
+
+    if (recordPath != NULL && saveSnakeReplay(&replay, recordPath))
+    {
+        printf("recorded the first game, %u ticks, to %s\n", replay.ticks, recordPath);
+    }
+
+    return 0;
+}
@@ -0,0 +1,607 @@
+#include "snake_replay.h"
+#include <stdio.h>
+
+// file layout, all little endian:
+//   magic, version, seed, tick rate, ticks, the 9 rule fields (uint32 each)
+//   input count (uint32), then per input a varint of (tick delta << 3) | action
+//   ticks checksums (uint32 each)
+//   keyframe count (uint32), then per keyframe its 14 fields, body cells and
+//   free cells (uint32 each); version 1 files end before this
+
+static uint32_t mixChecksum(uint32_t hash, uint32_t value)
+{
+    // fnv-1a over the four bytes
+    for (int i = 0; i < 4; i++)
+    {
+        hash = (hash ^ ((value >> (i * 8)) & 0xff)) * 16777619u;
+    }
+
+    return hash;
+}
+
+uint32_t snakeChecksum(const SnakeEngine* engine)
+{
+    // head, tail and length pin down the snake without walking it, and the
+    // random state changes with every food that is placed
+
+    uint32_t hash = 2166136261u;
+
+    hash = mixChecksum(hash, engine->tick);
+
+    hash = mixChecksum(hash, snakeHead(&engine->body));
+
+    hash = mixChecksum(hash, snakeTail(&engine->body));
+
+    hash = mixChecksum(hash, (uint32_t)engine->body.length);
+
+    hash = mixChecksum(hash, (uint32_t)engine->body.pendingGrowth);
+
+    hash = mixChecksum(hash, (uint32_t)(engine->dirX + 2) | (uint32_t)(engine->dirY + 2) << 4);
+
+    hash = mixChecksum(hash, engine->food);
+
+    hash = mixChecksum(hash, engine->bonusFood);
+
+    hash = mixChecksum(hash, engine->poisonFood);
+
+    hash = mixChecksum(hash, (uint32_t)engine->score);
+
+    hash = mixChecksum(hash, engine->random);
+
+    return mixChecksum(hash, engine->over);
+}
+
+void initSnakeReplay(SnakeReplay* replay, const SnakeRules* rules, uint32_t seed, int tickRate)
+{
+    replay->version = SNAKE_REPLAY_VERSION;
+
+    replay->rules = *rules;
+
+    replay->seed = seed;
+
+    replay->tickRate = tickRate;
+
+    replay->ticks = 0;
+
+    replay->inputs.clear();
+
+    replay->checksums.clear();
+
+    int boardCells = rules->columns * rules->rows;
+
+    replay->keyframeInterval = boardCells > SNAKE_KEYFRAME_INTERVAL ? boardCells : SNAKE_KEYFRAME_INTERVAL;
+
+    replay->keyframes.clear();
+
+    replay->keyframeCells.clear();
+
+    replay->dirX = 1; // every game starts heading right
+
+    replay->dirY = 0;
+}
+
+static void captureKeyframe(SnakeReplay* replay, const SnakeEngine* engine)
+{
+    SnakeKeyframe keyframe;
+
+    keyframe.tick = engine->tick;
+
+    keyframe.random = engine->random;
+
+    keyframe.score = engine->score;
+
+    keyframe.foodsEaten = engine->foodsEaten;
+
+    keyframe.dirX = engine->dirX;
+
+    keyframe.dirY = engine->dirY;
+
+    keyframe.food = engine->food;
+
+    keyframe.bonusFood = engine->bonusFood;
+
+    keyframe.poisonFood = engine->poisonFood;
+
+    keyframe.poisonExpiry = engine->poisonExpiry;
+
+    keyframe.lastTail = engine->lastTail;
+
+    keyframe.pendingGrowth = engine->body.pendingGrowth;
+
+    keyframe.length = engine->body.length;
+
+    keyframe.freeCount = (int)engine->freeCells.cells.size();
+
+    keyframe.firstCell = replay->keyframeCells.size();
+
+    for (int i = 0; i < engine->body.length; i++)
+    {
+        replay->keyframeCells.push_back(snakeSegment(&engine->body, i));
+    }
+
+    replay->keyframeCells.insert(replay->keyframeCells.end(), engine->freeCells.cells.begin(), engine->freeCells.cells.end());
+
+    replay->keyframes.push_back(keyframe);
+}
+
+static void restoreKeyframe(const SnakeReplay* replay, const SnakeKeyframe* keyframe, SnakeEngine* engine)
+{
+    const SnakeRules* rules = &replay->rules;
+
+    const SnakeCell* cells = &replay->keyframeCells[keyframe->firstCell];
+
+    clearSnakeBody(&engine->body);
+
+    initOccupancy(&engine->occupancy, rules->columns, rules->rows);
+
+    for (int i = 0; i < keyframe->length; i++)
+    {
+        appendSnakeTail(&engine->body, cells[i]);
+
+        occupyCell(&engine->occupancy, cellColumn(cells[i]), cellRow(cells[i]));
+    }
+
+    engine->body.pendingGrowth = keyframe->pendingGrowth;
+
+    restoreFreeCells(&engine->freeCells, rules->columns, rules->rows, cells + keyframe->length, keyframe->freeCount);
+
+    engine->tick = keyframe->tick;
+
+    engine->random = keyframe->random;
+
+    engine->score = keyframe->score;
+
+    engine->foodsEaten = keyframe->foodsEaten;
+
+    engine->dirX = keyframe->dirX;
+
+    engine->dirY = keyframe->dirY;
+
+    engine->food = keyframe->food;
+
+    engine->bonusFood = keyframe->bonusFood;
+
+    engine->poisonFood = keyframe->poisonFood;
+
+    engine->poisonExpiry = keyframe->poisonExpiry;
+
+    engine->lastTail = keyframe->lastTail;
+
+    engine->over = false;
+}
+
+void recordSnakeTick(SnakeReplay* replay, SnakeAction action, const SnakeEngine* engine)
+{
+    if (engine->tick == replay->ticks)
+    {
+        return; // the engine was already over, nothing happened
+    }
+
+    // keys that did not turn the snake change nothing, so they are not kept
+
+    if (engine->dirX != replay->dirX || engine->dirY != replay->dirY)
+    {
+        SnakeInput input = {engine->tick, (uint8_t)action};
+
+        replay->inputs.push_back(input);
+
+        replay->dirX = engine->dirX;
+
+        replay->dirY = engine->dirY;
+    }
+
+    replay->checksums.push_back(snakeChecksum(engine));
+
+    replay->ticks = engine->tick;
+
+    if (engine->tick % replay->keyframeInterval == 0 && !engine->over)
+    {
+        captureKeyframe(replay, engine);
+    }
+}
+
+static void writeU32(FILE* file, uint32_t value)
+{
+    unsigned char bytes[4] = {(unsigned char)value, (unsigned char)(value >> 8), (unsigned char)(value >> 16), (unsigned char)(value >> 24)};
+
+    fwrite(bytes, 1, 4, file);
+}
+
+static bool readU32(FILE* file, uint32_t* value)
+{
+    unsigned char bytes[4];
+
+    if (fread(bytes, 1, 4, file) != 4)
+    {
+        return false;
+    }
+
+    *value = bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+
+    return true;
+}
+
+static void writeVarint(FILE* file, uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        fputc((int)(value & 0x7f) | 0x80, file);
+
+        value >>= 7;
+    }
+
+    fputc((int)value, file);
+}
+
+static bool readVarint(FILE* file, uint32_t* value)
+{
+    *value = 0;
+
+    for (int shift = 0; shift < 35; shift += 7)
+    {
+        int byte = fgetc(file);
+
+        if (byte == EOF)
+        {
+            return false;
+        }
+
+        *value |= (uint32_t)(byte & 0x7f) << shift;
+
+        if (!(byte & 0x80))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// the rules in file order
+static int* ruleField(SnakeRules* rules, int index)
+{
+    int* fields[] = {&rules->columns, &rules->rows, &rules->foodScore, &rules->bonusEvery, &rules->bonusScore,
+                     &rules->bonusGrowth, &rules->poisonEvery, &rules->poisonPenalty, &rules->poisonTicks};
+
+    return fields[index];
+}
+
+#define SNAKE_RULE_FIELDS 9
+
+// the fixed part of a keyframe in file order
+static uint32_t* keyframeField(SnakeKeyframe* keyframe, int index)
+{
+    uint32_t* fields[] = {&keyframe->tick, &keyframe->random, (uint32_t*)&keyframe->score, (uint32_t*)&keyframe->foodsEaten,
+                          (uint32_t*)&keyframe->dirX, (uint32_t*)&keyframe->dirY, &keyframe->food, &keyframe->bonusFood,
+                          &keyframe->poisonFood, &keyframe->poisonExpiry, &keyframe->lastTail, (uint32_t*)&keyframe->pendingGrowth,
+                          (uint32_t*)&keyframe->length, (uint32_t*)&keyframe->freeCount};
+
+    return fields[index];
+}
+
+#define SNAKE_KEYFRAME_FIELDS 14
+
+bool saveSnakeReplay(const SnakeReplay* replay, const char* path)
+{
+    FILE* file = fopen(path, "wb");
+
+    if (file == NULL)
+    {
+        printf("Cannot write replay %s\n", path);
+
+        return false;
+    }
+
+    writeU32(file, SNAKE_REPLAY_MAGIC);
+
+    writeU32(file, SNAKE_REPLAY_VERSION);
+
+    writeU32(file, replay->seed);
+
+    writeU32(file, (uint32_t)replay->tickRate);
+
+    writeU32(file, replay->ticks);
+
+    SnakeRules rules = replay->rules;
+
+    for (int i = 0; i < SNAKE_RULE_FIELDS; i++)
+    {
+        writeU32(file, (uint32_t)*ruleField(&rules, i));
+    }
+
+    writeU32(file, (uint32_t)replay->inputs.size());
+
+    uint32_t lastTick = 0;
+
+    for (const SnakeInput& input : replay->inputs)
+    {
+        writeVarint(file, (input.tick - lastTick) << 3 | input.action);
+
+        lastTick = input.tick;
+    }
+
+    for (uint32_t checksum : replay->checksums)
+    {
+        writeU32(file, checksum);
+    }
+
+    writeU32(file, (uint32_t)replay->keyframes.size());
+
+    for (SnakeKeyframe keyframe : replay->keyframes)
+    {
+        for (int i = 0; i < SNAKE_KEYFRAME_FIELDS; i++)
+        {
+            writeU32(file, *keyframeField(&keyframe, i));
+        }
+
+        for (int i = 0; i < keyframe.length + keyframe.freeCount; i++)
+        {
+            writeU32(file, replay->keyframeCells[keyframe.firstCell + i]);
+        }
+    }
+
+    bool ok = ferror(file) == 0;
+
+    fclose(file);
+
+    if (!ok)
+    {
+        printf("Writing replay %s failed\n", path);
+    }
+
+    return ok;
+}
+
+static bool cellOnBoard(const SnakeRules* rules, SnakeCell cell)
+{
+    return cellColumn(cell) < rules->columns && cellRow(cell) < rules->rows;
+}
+
+// a keyframe from a file is only restored if every field it hands the engine
+// stays on the board, anything else would index outside its grids
+static bool validKeyframe(const SnakeReplay* replay, const SnakeKeyframe* keyframe, int boardCells)
+{
+    const SnakeRules* rules = &replay->rules;
+
+    bool foodOk = (keyframe->food == SNAKE_NO_CELL || cellOnBoard(rules, keyframe->food)) &&
+                  (keyframe->bonusFood == SNAKE_NO_CELL || cellOnBoard(rules, keyframe->bonusFood)) &&
+                  (keyframe->poisonFood == SNAKE_NO_CELL || cellOnBoard(rules, keyframe->poisonFood));
+
+    // one step along exactly one axis
+
+    bool dirOk = keyframe->dirX >= -1 && keyframe->dirX <= 1 && keyframe->dirY >= -1 && keyframe->dirY <= 1 &&
+                 (keyframe->dirX == 0) != (keyframe->dirY == 0);
+
+    bool sizeOk = keyframe->length >= 1 && keyframe->freeCount >= 0 && (long long)keyframe->length + keyframe->freeCount <= boardCells &&
+                  keyframe->pendingGrowth >= 0 && keyframe->pendingGrowth <= boardCells;
+
+    return foodOk && dirOk && sizeOk && cellOnBoard(rules, keyframe->lastTail);
+}
+
+bool loadSnakeReplay(SnakeReplay* replay, const char* path)
+{
+    FILE* file = fopen(path, "rb");
+
+    if (file == NULL)
+    {
+        printf("Cannot open replay %s\n", path);
+
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0, tickRate = 0, inputCount = 0;
+
+    bool ok = readU32(file, &magic) && readU32(file, &version) && magic == SNAKE_REPLAY_MAGIC && version >= 1 && version <= SNAKE_REPLAY_VERSION &&
+              readU32(file, &replay->seed) && readU32(file, &tickRate) && readU32(file, &replay->ticks);
+
+    for (int i = 0; ok && i < SNAKE_RULE_FIELDS; i++)
+    {
+        uint32_t value;
+
+        ok = readU32(file, &value);
+
+        *ruleField(&replay->rules, i) = (int)value;
+    }
+
+    ok = ok && replay->rules.columns >= SNAKE_START_LENGTH && replay->rules.columns <= 0xffff &&
+         replay->rules.rows >= 1 && replay->rules.rows <= 0xffff && tickRate > 0 &&
+         (long long)replay->rules.columns * replay->rules.rows <= SNAKE_REPLAY_MAX_CELLS;
+
+    ok = ok && readU32(file, &inputCount) && inputCount <= replay->ticks;
+
+    replay->version = version;
+
+    replay->tickRate = (int)tickRate;
+
+    int boardCells = ok ? replay->rules.columns * replay->rules.rows : 0;
+
+    replay->keyframeInterval = boardCells > SNAKE_KEYFRAME_INTERVAL ? boardCells : SNAKE_KEYFRAME_INTERVAL;
+
+    replay->inputs.clear();
+
+    replay->checksums.clear();
+
+    uint32_t tick = 0;
+
+    for (uint32_t i = 0; ok && i < inputCount; i++)
+    {
+        uint32_t packed;
+
+        ok = readVarint(file, &packed);
+
+        // each input lands on a tick of the recording with one of the actions
+
+        ok = ok && (uint64_t)tick + (packed >> 3) <= replay->ticks && (packed & 7) <= SNAKE_RIGHT;
+
+        tick += packed >> 3;
+
+        SnakeInput input = {tick, (uint8_t)(packed & 7)};
+
+        replay->inputs.push_back(input);
+    }
+
+    for (uint32_t i = 0; ok && i < replay->ticks; i++)
+    {
+        uint32_t checksum;
+
+        ok = readU32(file, &checksum);
+
+        replay->checksums.push_back(checksum);
+    }
+
+    replay->keyframes.clear();
+
+    replay->keyframeCells.clear();
+
+    uint32_t keyframeCount = 0;
+
+    ok = ok && (version < 2 || readU32(file, &keyframeCount));
+
+    for (uint32_t i = 0; ok && i < keyframeCount; i++)
+    {
+        SnakeKeyframe keyframe;
+
+        for (int field = 0; ok && field < SNAKE_KEYFRAME_FIELDS; field++)
+        {
+            ok = readU32(file, keyframeField(&keyframe, field));
+        }
+
+        // the cells must fit the board, and keyframes come in tick order
+
+        ok = ok && validKeyframe(replay, &keyframe, boardCells) &&
+             keyframe.tick <= replay->ticks && (replay->keyframes.empty() || keyframe.tick > replay->keyframes.back().tick);
+
+        keyframe.firstCell = replay->keyframeCells.size();
+
+        for (int cell = 0; ok && cell < keyframe.length + keyframe.freeCount; cell++)
+        {
+            uint32_t value;
+
+            ok = readU32(file, &value) && cellOnBoard(&replay->rules, value);
+
+            replay->keyframeCells.push_back(value);
+        }
+
+        replay->keyframes.push_back(keyframe);
+    }
+
+    fclose(file);
+
+    if (ok && !replay->keyframes.empty())
+    {
+        replay->keyframeInterval = replay->keyframes[0].tick; // as it was recorded
+    }
+
+    if (!ok)
+    {
+        printf("%s is not a valid snake replay\n", path);
+    }
+
+    return ok;
+}
+
+void initSnakeReplayPlayer(SnakeReplayPlayer* player, const SnakeReplay* replay, SnakeEngine* engine)
+{
+    player->replay = replay;
+
+    player->nextInput = 0;
+
+    player->divergedAt = 0;
+
+    initSnakeEngine(engine, &replay->rules, replay->seed);
+}
+
+static void checkReplayTick(SnakeReplayPlayer* player, const SnakeEngine* engine)
+{
+    const SnakeReplay* replay = player->replay;
+
+    if (player->divergedAt == 0 && engine->tick >= 1 && engine->tick <= replay->checksums.size() &&
+        snakeChecksum(engine) != replay->checksums[engine->tick - 1])
+    {
+        player->divergedAt = engine->tick;
+    }
+}
+
+int stepSnakeReplay(SnakeReplayPlayer* player, SnakeEngine* engine)
+{
+    const SnakeReplay* replay = player->replay;
+
+    SnakeAction action = SNAKE_KEEP;
+
+    if (player->nextInput < replay->inputs.size() && replay->inputs[player->nextInput].tick == engine->tick + 1)
+    {
+        action = (SnakeAction)replay->inputs[player->nextInput++].action;
+    }
+
+    uint32_t tick = engine->tick;
+
+    int events = stepSnakeEngine(engine, action);
+
+    // older recordings counted the tick the snake ran into something on
+
+    if (replay->version < 3 && (events & SNAKE_DIED) && engine->tick == tick)
+    {
+        engine->tick++;
+    }
+
+    checkReplayTick(player, engine);
+
+    return events;
+}
+
+void seekSnakeReplay(SnakeReplayPlayer* player, SnakeEngine* engine, uint32_t tick)
+{
+    const SnakeReplay* replay = player->replay;
+
+    tick = tick < replay->ticks ? tick : replay->ticks;
+
+    // the last keyframe at or before tick
+
+    int keyframe = (int)replay->keyframes.size() - 1;
+
+    while (keyframe >= 0 && replay->keyframes[keyframe].tick > tick)
+    {
+        keyframe--;
+    }
+
+    uint32_t start = keyframe >= 0 ? replay->keyframes[keyframe].tick : 0;
+
+    if (tick < engine->tick || start > engine->tick)
+    {
+        if (keyframe >= 0)
+        {
+            restoreKeyframe(replay, &replay->keyframes[keyframe], engine);
+
+            checkReplayTick(player, engine);
+        }
+        else
+        {
+            resetSnakeEngine(engine, replay->seed);
+        }
+
+        // the first input after the restored tick
+
+        size_t low = 0, high = replay->inputs.size();
+
+        while (low < high)
+        {
+            size_t middle = (low + high) / 2;
+
+            if (replay->inputs[middle].tick <= engine->tick)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        player->nextInput = low;
+    }
+
+    while (engine->tick < tick && !engine->over)
+    {
+        stepSnakeReplay(player, engine);
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef SNAKE_REPLAY_H
+#define SNAKE_REPLAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "snake_engine.h"
+
+// a game as its seed, its rules and the ticks on which a direction key was
+// pressed; the engine is deterministic, so that is enough to play it again.
+// a checksum of the engine state after every tick tells where a replay
+// stops matching the recording, and a snapshot of the whole state every
+// keyframeInterval ticks lets a seek start close to where it lands
+
+#define SNAKE_REPLAY_MAGIC 0x524b4e53u // "SNKR"
+#define SNAKE_REPLAY_VERSION 3 // 1 had no keyframes, 1 and 2 counted the tick a snake died on; both still readable
+#define SNAKE_KEYFRAME_INTERVAL 1024 // ticks between keyframes, or the board's cell count if that is more
+#define SNAKE_REPLAY_MAX_CELLS (1 << 24) // largest board a replay may ask for, columns * rows
+
+typedef struct SnakeInput
+{
+    uint32_t tick; // engine tick the action was applied on, from 1
+    uint8_t action;
+} SnakeInput;
+
+// the engine state after a tick; its body cells (head first) and then its
+// free cells in their array order are stored in SnakeReplay::keyframeCells
+typedef struct SnakeKeyframe
+{
+    uint32_t tick;
+    uint32_t random;
+    int score;
+    int foodsEaten;
+    int dirX, dirY;
+    SnakeCell food, bonusFood, poisonFood;
+    uint32_t poisonExpiry;
+    SnakeCell lastTail;
+    int pendingGrowth;
+    int length;
+    int freeCount;
+    size_t firstCell;
+} SnakeKeyframe;
+
+typedef struct SnakeReplay
+{
+    uint32_t version; // of the file it was loaded from
+    SnakeRules rules;
+    uint32_t seed;
+    int tickRate; // ticks per second it was played at
+    uint32_t ticks;
+    std::vector<SnakeInput> inputs; // only the actions that turned the snake
+    std::vector<uint32_t> checksums; // one per tick, checksums[0] after tick 1
+    uint32_t keyframeInterval; // a keyframe stores every cell, so on big boards
+                               // they are spaced to about 4 bytes per tick
+    std::vector<SnakeKeyframe> keyframes;
+    std::vector<SnakeCell> keyframeCells;
+    int dirX, dirY; // direction while recording, to spot the turns
+} SnakeReplay;
+
+typedef struct SnakeReplayPlayer
+{
+    const SnakeReplay* replay;
+    size_t nextInput;
+    uint32_t divergedAt; // first tick whose checksum did not match, 0 if none
+} SnakeReplayPlayer;
+
+uint32_t snakeChecksum(const SnakeEngine* engine);
+
+void initSnakeReplay(SnakeReplay* replay, const SnakeRules* rules, uint32_t seed, int tickRate);
+
+// call after every stepSnakeEngine with the action that was passed to it
+void recordSnakeTick(SnakeReplay* replay, SnakeAction action, const SnakeEngine* engine);
+
+bool saveSnakeReplay(const SnakeReplay* replay, const char* path);
+
+bool loadSnakeReplay(SnakeReplay* replay, const char* path);
+
+// sets up engine with the rules and seed of the recording
+void initSnakeReplayPlayer(SnakeReplayPlayer* player, const SnakeReplay* replay, SnakeEngine* engine);
+
+inline bool snakeReplayFinished(const SnakeReplayPlayer* player, const SnakeEngine* engine)
+{
+    return engine->tick >= player->replay->ticks || engine->over;
+}
+
+// steps engine with the recorded action of the next tick and checks the result
+int stepSnakeReplay(SnakeReplayPlayer* player, SnakeEngine* engine);
+
+// puts engine at tick, backwards or forwards: restores the last keyframe at or
+// before it (or the start) unless going on from where engine is is shorter
+void seekSnakeReplay(SnakeReplayPlayer* player, SnakeEngine* engine, uint32_t tick);
+
+#endif